@@ -33,11 +33,14 @@
 #include "./inc/KinetisKE_csl_gpio.h"
 #include "./inc/KinetisKE_csl_gpio_ex.h"
 #include "./inc/KinetisKE_csl_irq.h"
+#include "./inc/KinetisKE_csl_lin.h"
 #include "./inc/KinetisKE_csl_pit.h"
 #include "./inc/KinetisKE_csl_pmc.h"
 #include "./inc/KinetisKE_csl_pwt.h"
-//#include "./inc/KinetisKE_csl_spi.h"
+#include "./inc/KinetisKE_csl_spi.h"
+#include "./inc/KinetisKE_csl_spi_ex.h"
 #include "./inc/KinetisKE_csl_uart.h"
+#include "./inc/KinetisKE_csl_uart_ex.h"
 #include "./inc/KinetisKE_csl_wdog.h"
 
 #ifdef __cplusplus
@@ -57,6 +57,33 @@ typedef struct
 	uint32_t HardTrigger;
 }ADC_TrigTypeDef;
 
+/**
+ * ADC Stream Frame(one FIFO Scan)
+**/
+typedef struct
+{
+	uint32_t Timestamp;				//SysTick Clocks when the Frame is drained
+	uint16_t Value[8];				//Results in order of FIFO.Channel[]
+}ADC_FrameTypeDef;
+
+/**
+ * ADC Streaming Structure
+**/
+typedef struct
+{
+	ADC_FrameTypeDef*		pRing;			//Frame Ring Buffer, NULL if Streaming is stopped
+	uint16_t				Mask;			//Ring Size - 1(Size is Power of 2)
+	__IO uint16_t			Head;			//Producer Index(ISR, free running)
+	__IO uint16_t			Tail;			//Consumer Index(free running)
+	uint32_t				Period;			//Nominal Trigger Period in SysTick Clocks, 0 if unknown
+	uint32_t				LastStamp;		//Timestamp of previous Frame
+	__IO uint32_t			MinPeriod;		//Shortest Frame Interval
+	__IO uint32_t			MaxPeriod;		//Longest Frame Interval
+	__IO uint32_t			Frames;			//Frames drained from FIFO
+	__IO uint32_t			Overflow;		//Frames dropped because Ring is full
+	__IO uint32_t			Missed;			//Triggers lost(masked while FIFO is not drained)
+}ADC_StreamTypeDef;
+
 /**
  * ADC Initialize Structure(Basic)
 **/
@@ -79,6 +106,11 @@ typedef enum
 	CSL_ADC_STATE_READY		= 0x01u,			//ADC is Ready
 	CSL_ADC_STATE_CPLT		= 0x02u,			//ADC is Convertion Complete
 	CSL_ADC_STATE_FULL		= 0x03u,			//ADC FIFO is FULL
+	CSL_ADC_STATE_STREAM	= 0x04u,			//ADC is Streaming Frames on Hardware Trigger
+	CSL_ADC_STATE_OVERSAMPLE	= 0x05u,		//ADC is Oversampling(CSL_ADCEx_Oversample_Start())
+	CSL_ADC_STATE_MONITOR	= 0x06u,			//ADC is Monitoring a Window in STOP Mode(CSL_ADCEx_Monitor())
+	CSL_ADC_STATE_SEQUENCE	= 0x07u,			//ADC is running a Channel Sequence(CSL_ADCEx_Sequence_Start())
+	CSL_ADC_STATE_PWMSYNC	= 0x08u,			//ADC is triggered by FTM2 PWM(CSL_ADCEx_PWMSync_Start())
 }ADC_StateTypeDef;
 
 /**
@@ -91,6 +123,7 @@ typedef struct
 	ADC_FIFOTypeDef 		FIFO;				//FIFO Configuration Structure
 	ADC_CompTypeDef 		Compare;			//Compare Configuration Structure
 	ADC_TrigTypeDef 		Trigger;			//Trigger Configuration Structure
+	ADC_StreamTypeDef		Stream;				//Streaming Acquisition
 }ADC_HandleTypeDef;
 
 /**
@@ -115,8 +148,8 @@ typedef struct
 #define ADC_Channel_Vss				0x10u				//Digital Ground
 #define ADC_Channel_T				0x16u				//Temperature Sensor
 #define ADC_Channel_BG				0x17u				//Bandgap Reference
-#define ADC_Channel_RH				0x1Du				//Reference Low-Level
-#define ADC_Channel_RL				0x1Eu				//Reference High-Level
+#define ADC_Channel_RH				0x1Du				//Reference High-Level
+#define ADC_Channel_RL				0x1Eu				//Reference Low-Level
 #define ADC_Channel_None			0x1Fu				//Disable ADC & Reset ADC FIFO
 
 /**
@@ -165,7 +198,7 @@ typedef struct
 #define ADC_HTRIG_PITCH0			0x00400000u			//PIT Channel0 Overrun
 #define ADC_HTRIG_PITCH1			0x00500000u			//PIT Channel1 Overrun
 #define ADC_HTRIG_ACMP0				0x00600000u			//ACMP0 Output
-#define ADC_HTRIG_ACMP1				0x007000000u		//ACMP1 Output
+#define ADC_HTRIG_ACMP1				0x00700000u			//ACMP1 Output
 
 /**
  * ADC Compare Mode
@@ -227,9 +260,17 @@ void CSL_ADC_MspDeInit(ADC_HandleTypeDef* cadc);
 uint16_t CSL_ADC_GetSingleValue(ADC_HandleTypeDef* cadc);
 CSL_StatusTypeDef CSL_ADC_GetFIFOValues(ADC_HandleTypeDef* cadc, uint16_t* pBuffer, uint8_t Size);
 
+//ADC Streaming Acquisition
+CSL_StatusTypeDef CSL_ADC_StreamStart(ADC_HandleTypeDef* cadc, ADC_FrameTypeDef* RingBuffer, uint16_t Size, uint32_t Period);
+CSL_StatusTypeDef CSL_ADC_StreamStop(ADC_HandleTypeDef* cadc);
+uint16_t CSL_ADC_StreamRead(ADC_HandleTypeDef* cadc, ADC_FrameTypeDef* pFrame, uint16_t Count);
+uint32_t CSL_ADC_GetStreamJitter(ADC_HandleTypeDef* cadc);
+uint32_t CSL_ADC_GetStreamDropped(ADC_HandleTypeDef* cadc);
+
 //ADC Interrupt
 void CSL_ADC_IRQHandler(ADC_HandleTypeDef* cadc);
 void CSL_ADC_ConvCpltCallback(ADC_HandleTypeDef* cadc);
+void CSL_ADC_StreamFrameCallback(ADC_HandleTypeDef* cadc);
 
 /* Defgroup for ADC Module Parameters Check */
 #define IS_ADC_Channel(ch)				((ch == ADC_Channel_0) || \
@@ -257,6 +298,7 @@ void CSL_ADC_ConvCpltCallback(ADC_HandleTypeDef* cadc);
 #define IS_ADC_REF(ref)					((ref == 0x00u) || (ref == 0x01u) || (ref == 0x03u))
 #define IS_ADC_CLKSource(clk)			((clk == 0x00u) || (clk == 0x01u) || (clk == 0x02u) || (clk == 0x03u))
 #define IS_ADC_CLKPSC(div)				((div == 0x00u) || (div == 0x01u) || (div == 0x02u) || (div == 0x03u))
+#define IS_ADC_RingSize(size)			((size >= 2u) && (size <= 0x8000u) && ((size & (size - 1u)) == 0u))
 
 #ifdef __cplusplus
  }
@@ -13,12 +13,236 @@
 #endif /*__cplusplus*/
 
 #include "KinetisKE_csl_adc.h"
+#include "KinetisKE_csl_pmc.h"
+#include "KinetisKE_csl_ftm.h"
+#include "KinetisKE_csl_flash.h"
+
+/**
+ * ADC Calibration(Fixed-Point Scale Factors from Bandgap)
+**/
+typedef struct
+{
+	uint16_t				BandgapCode;	//12-bit Code of Bandgap Reference(averaged)
+	uint16_t				VREF_mV;		//Reference Voltage solved from Bandgap, mV per 4096 Codes
+	uint16_t				Temp25Code;		//Temperature Sensor Code at 25 Celsius in Q4
+	uint16_t				TempSlopeCold;	//0.01 Celsius per Q4 Code in Q12(below 25 Celsius)
+	uint16_t				TempSlopeHot;	//0.01 Celsius per Q4 Code in Q12(above 25 Celsius)
+}ADC_CalibTypeDef;
+
+/**
+ * ADC Self-Test Result(Offset & Gain Correction from Vss/RL/RH, stored in Flash)
+**/
+typedef struct
+{
+	uint32_t				Magic;			//ADC_SELFTEST_MAGIC if Coefficients are valid
+	uint16_t				CodeVss;		//Code of ADC_Channel_Vss in Q4
+	uint16_t				CodeRL;			//Code of ADC_Channel_RL in Q4
+	uint16_t				CodeRH;			//Code of ADC_Channel_RH in Q4
+	int16_t					Offset;			//Offset in Q4 Codes(CodeRL)
+	uint16_t				Gain;			//Gain Correction in Q15(ADC_SELFTEST_GAIN_ONE is 1.0)
+	uint16_t				Check;			//Checksum of Fields above
+}ADC_SelfTestTypeDef;
+
+/**
+ * ADC Oversampling Channel
+**/
+typedef struct
+{
+	uint8_t					Channel;		//ADC Channel
+	uint8_t					Bits;			//Extra Bits n(0 ~ 4), 4^n Samples are accumulated
+	__IO uint16_t			Result;			//Decimated Result(12 + n Bits)
+}ADC_OversampleChannelTypeDef;
+
+/**
+ * ADC Oversampling Handle
+**/
+typedef struct
+{
+	ADC_HandleTypeDef*				cadc;			//ADC(initialized by CSL_ADC_Init(), 12 Bits)
+	ADC_OversampleChannelTypeDef*	pChannel;		//Channels sampled in turn
+	uint8_t							Count;			//Number of Channels
+	uint8_t							Index;			//Channel being sampled
+	uint8_t							Batch;			//Samples per FIFO Scan(1, 4 or 8)
+	uint16_t						Remain;			//Samples left for this Channel
+	uint32_t						Accumulator;	//Sum of Samples
+	__IO uint32_t					Rounds;			//Passes over all Channels
+}ADC_OversampleTypeDef;
+
+/**
+ * ADC Window Monitor in STOP Mode
+**/
+typedef struct
+{
+	ADC_HandleTypeDef*		cadc;			//ADC(initialized by CSL_ADC_Init())
+	uint8_t					Channel;		//ADC Channel to be monitored
+	uint16_t				Low;			//wake when Value < Low, ADC_MONITOR_LOW_NONE to disable
+	uint16_t				High;			//wake when Value > High, ADC_MONITOR_HIGH_NONE to disable
+	uint32_t				Period;			//Sample Period in ms(multiple of ADC_MONITOR_TICK_MS)
+	uint8_t					Side;			//Bound armed in Hardware Compare
+	__IO uint32_t			Overflows;		//RTC Periods elapsed in STOP
+	__IO Flag_Status		Hit;			//SET when a Value is out of Window
+	__IO uint16_t			Value;			//Value captured by Compare Hit
+	uint32_t				SleepTime;		//Time spent in STOP in ms
+}ADC_MonitorTypeDef;
+
+/**
+ * ADC Fixed-Point Filter(State of one Channel)
+**/
+typedef struct
+{
+	uint8_t					Type;			//Filter Type
+	uint8_t					Length;			//Window(Boxcar: Power of 2, Median: odd), ADC_FILTER_WINDOW at most
+	int16_t					Coeff[5];		//Biquad b0, b1, b2, a1, a2 in Q14
+	uint8_t					Shift;			//log2(Length) of Boxcar
+	uint8_t					Index;			//Oldest Sample in Window
+	Flag_Status				Primed;			//SET after first Sample
+	uint32_t				Sum;			//Boxcar Running Sum
+	int32_t					State[5];		//Biquad x[n-1], x[n-2], y[n-1], y[n-2] & Fraction of y
+	uint16_t				Window[ADC_FILTER_WINDOW];	//Samples in arrival Order
+	uint16_t				Sorted[ADC_FILTER_WINDOW];	//Samples in Order of Value(Median)
+}ADC_FilterTypeDef;
+
+/**
+ * ADC Sequence Entry
+**/
+typedef struct
+{
+	uint8_t					Channel;		//ADC Channel
+	uint8_t					Samples;		//Conversions of this Channel(1 ~ 8)
+}ADC_SequenceEntryTypeDef;
+
+/**
+ * ADC Channel Sequencer Handle
+**/
+typedef struct
+{
+	ADC_HandleTypeDef*					cadc;			//ADC(initialized by CSL_ADC_Init())
+	const ADC_SequenceEntryTypeDef*		pEntry;			//Channel List
+	uint8_t								Count;			//Entries in Channel List
+	uint16_t*							pResult;		//Sum of Samples per Entry(Count)
+	Flag_Status							Continuous;		//SET to restart Sequence in ISR
+	uint8_t								First;			//first Entry of Segment converting
+	uint8_t								Next;			//first Entry of next Segment
+	uint8_t								Conversions;	//Conversions of Segment converting
+	__IO uint32_t						Sequences;		//Sequences completed
+}ADC_SequenceTypeDef;
+
+/**
+ * ADC Sampling synchronized to FTM2 PWM
+**/
+typedef struct
+{
+	ADC_HandleTypeDef*		cadc;			//ADC(initialized by CSL_ADC_Init(), FIFO.Channel[] & FIFO.Depth are sampled)
+	FTM_HandleTypeDef*		cftm;			//FTM2 running PWM
+	uint8_t					PWMChannel;		//FTM2 Channel driving High-Side(high-true)
+	uint8_t					TrigChannel;	//FTM2 Channel used as ADC Trigger only(no Pin)
+	uint16_t				Position;		//Trigger in Low-Side On-Time, Q16(0x8000 is middle)
+	uint8_t					Delay;			//Bus Clocks from Match to ADC Trigger(SIM_SOPT0[DELAY])
+	uint16_t				TrigPoint;		//FTM2 Count of Trigger
+	uint16_t				Buffer[2][8];	//Results per PWM Cycle(Ping-Pong)
+	__IO uint8_t			Ready;			//Buffer of last complete Cycle
+	__IO uint32_t			Cycles;			//PWM Cycles converted
+	__IO uint16_t			Latency;		//Trigger-to-Result of last Cycle in FTM2 Counts
+	__IO uint16_t			MaxLatency;		//Longest Trigger-to-Result in FTM2 Counts
+}ADC_PWMSyncTypeDef;
+
+/**
+ * Bandgap & Temperature Sensor(DataSheet, Typical)
+**/
+#define ADC_BANDGAP_MV				1160u		//Bandgap Reference Voltage
+#define ADC_TEMP25_MV				1396u		//Temperature Sensor Voltage at 25 Celsius
+#define ADC_TEMP_SLOPE_COLD_UV		3266u		//uV per Celsius below 25 Celsius
+#define ADC_TEMP_SLOPE_HOT_UV		3638u		//uV per Celsius above 25 Celsius
+#define ADC_VREF_MIN_MV				2000u		//Bandgap Code out of Range is rejected
+#define ADC_VREF_MAX_MV				6000u
+
+/**
+ * ADC Self-Test
+**/
+#define ADC_SELFTEST_MAGIC			0x41444353u	//"ADCS"
+#define ADC_SELFTEST_GAIN_ONE		0x8000u		//1.0 in Q15 Gain
+#define ADC_SELFTEST_MAX_ERROR		0x40u		//Max Codes a Reference may be off its ideal Code
+
+/**
+ * ADC Window Monitor
+ * RTC is clocked by LPO(1kHz) / 100, its Overflow triggers one Conversion
+**/
+#define ADC_MONITOR_LOW_NONE		0x0000u		//Low Bound disabled
+#define ADC_MONITOR_HIGH_NONE		0xFFFFu		//High Bound disabled
+#define ADC_MONITOR_TICK_MS			100u		//Resolution of Period & SleepTime
+#define ADC_MONITOR_SIDE_LOW		0x00u		//Compare: Value < Low
+#define ADC_MONITOR_SIDE_HIGH		0x01u		//Compare: Value > High
+
+/**
+ * ADC Filter Type
+**/
+#define ADC_FILTER_BOXCAR			0x01u		//Moving Average
+#define ADC_FILTER_MEDIAN			0x02u		//Running Median
+#define ADC_FILTER_BIQUAD			0x03u		//IIR, first Order with b2 = a2 = 0
+#define ADC_FILTER_Q14_ONE			0x4000u		//1.0 in Q14 Coefficients
+
+/**
+ * ADC Channel Sequencer
+**/
+#define ADC_SEQUENCE_SEGMENT		0x08u		//Conversions per FIFO Segment(ADC_FIFO_D8)
+
+/**
+ * ADC PWM Synchronized Sampling
+**/
+#define ADC_PWMSYNC_MIDDLE			0x8000u		//middle of Low-Side On-Time
+
+/**
+ * ADC Oversampling Extra Bits(4^n Samples)
+**/
+#define ADC_OVERSAMPLE_MAX_BITS		0x04u		//256 Samples, 16-bit Result
 
 /* Functions for ADC Extra Functions */
 void CSL_ADCEx_TemperatureSensor_Init(uint8_t ref);
 void CSL_ADCEx_MspInit(void);
 float CSL_ADCEx_GetTemperature(uint16_t Value);
 
+/* Functions for ADC Fixed-Point Conversion */
+CSL_StatusTypeDef CSL_ADCEx_Calibrate(ADC_HandleTypeDef* cadc, ADC_CalibTypeDef* ccal);
+CSL_StatusTypeDef CSL_ADCEx_CalibrateFromCode(ADC_CalibTypeDef* ccal, uint16_t BandgapCode);
+uint16_t CSL_ADCEx_ToMilliVolt(const ADC_CalibTypeDef* ccal, uint16_t Value);
+int16_t CSL_ADCEx_ToTemperature(const ADC_CalibTypeDef* ccal, uint16_t Value);
+uint16_t CSL_ADCEx_ToRatio(uint16_t Value);
+
+/* Functions for ADC Self-Test & Correction */
+CSL_StatusTypeDef CSL_ADCEx_SelfTest(ADC_HandleTypeDef* cadc, ADC_SelfTestTypeDef* ctest);
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Save(const ADC_SelfTestTypeDef* ctest, uint16_t SectorNum);
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Load(ADC_SelfTestTypeDef* ctest, uint16_t SectorNum);
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Init(ADC_HandleTypeDef* cadc, ADC_SelfTestTypeDef* ctest, uint16_t SectorNum);
+uint16_t CSL_ADCEx_Correct(const ADC_SelfTestTypeDef* ctest, uint16_t Value);
+
+/* Functions for ADC Fixed-Point Filter */
+CSL_StatusTypeDef CSL_ADCEx_Filter_Init(ADC_FilterTypeDef* cflt);
+void CSL_ADCEx_Filter_Process(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride);
+
+/* Functions for ADC Channel Sequencer */
+CSL_StatusTypeDef CSL_ADCEx_Sequence_Start(ADC_SequenceTypeDef* cseq);
+CSL_StatusTypeDef CSL_ADCEx_Sequence_Stop(ADC_SequenceTypeDef* cseq);
+void CSL_ADCEx_Sequence_IRQHandler(ADC_SequenceTypeDef* cseq);
+void CSL_ADCEx_SequenceCpltCallback(ADC_SequenceTypeDef* cseq);
+
+/* Functions for ADC PWM Synchronized Sampling */
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_Start(ADC_PWMSyncTypeDef* csync);
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_Stop(ADC_PWMSyncTypeDef* csync);
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_SetDuty(ADC_PWMSyncTypeDef* csync, uint16_t Pulse);
+void CSL_ADCEx_PWMSync_IRQHandler(ADC_PWMSyncTypeDef* csync);
+void CSL_ADCEx_PWMSyncCpltCallback(ADC_PWMSyncTypeDef* csync, const uint16_t* pResult);
+
+/* Functions for ADC Window Monitor */
+CSL_StatusTypeDef CSL_ADCEx_Monitor(ADC_MonitorTypeDef* cmon);
+void CSL_ADCEx_Monitor_ADC_IRQHandler(ADC_MonitorTypeDef* cmon);
+void CSL_ADCEx_Monitor_RTC_IRQHandler(ADC_MonitorTypeDef* cmon);
+
+/* Functions for ADC Oversampling */
+CSL_StatusTypeDef CSL_ADCEx_Oversample_Start(ADC_OversampleTypeDef* cos);
+CSL_StatusTypeDef CSL_ADCEx_Oversample_Stop(ADC_OversampleTypeDef* cos);
+void CSL_ADCEx_Oversample_IRQHandler(ADC_OversampleTypeDef* cos);
+void CSL_ADCEx_OversampleCpltCallback(ADC_OversampleTypeDef* cos);
+
 #ifdef __cplusplus
  }
 #endif /*__cplusplus*/
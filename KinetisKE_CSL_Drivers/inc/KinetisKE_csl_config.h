@@ -29,6 +29,28 @@
 **/
 #define	ICS_EXTI_STAT			0x01u
 
+/* UART Control Bits */
+/**
+ * @brief	Enable/Disable UART Statistics(UART_HandleTypeDef.Stats)
+ * @arg		0x00u	Statistics Disabled(compiled out)
+			0x01u	Statistics Enabled, IRQ duration is measured by SysTick
+**/
+#define UART_STATISTICS_STAT	0x00u
+
+/* SPI Control Bits */
+/**
+ * @brief	Depth of SPI Transaction Queue(SPI_HandleTypeDef.pQueue)
+ * @arg		Power of 2(2 ~ 128), Transactions pending per SPI Instance
+**/
+#define SPI_QUEUE_DEPTH			0x08u
+
+/* ADC Control Bits */
+/**
+ * @brief	Max Window of ADC Boxcar/Median Filter(ADC_FilterTypeDef.Window)
+ * @arg		3 ~ 32, two uint16_t per Sample are kept for each Channel
+**/
+#define ADC_FILTER_WINDOW		0x10u
+
 /* Flash Control Bits */
 /**
  * @brief	Enable/Disable Flash Speclated
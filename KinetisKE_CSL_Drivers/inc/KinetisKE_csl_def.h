@@ -30,12 +30,14 @@ typedef enum
 }CSL_StatusTypeDef;
 
 /**
- * @brief	Flag/IT Status
+ * @brief	Flag/IT Status & Functional State
 **/
 typedef enum
 {
 	RESET 	= 0,
 	SET		= !RESET,
+	DISABLE	= RESET,			//for FunctionalState
+	ENABLE	= SET,
 }FunctionalState, Flag_Status, IT_Status;
 
 /**
@@ -47,6 +49,15 @@ typedef enum
 	CSL_UNLOCKED 	= 0x01U,
 }CSL_LockTypeDef;
 
+/**
+ * @brief	I/O Vector Segment of Scatter-Gather Transfers
+**/
+typedef struct
+{
+	const uint8_t*	pData;		//Data of Segment
+	uint16_t		Size;		//Size of Segment
+}CSL_IOVecTypeDef;
+
 /**
  * @brief	Exported Macros
 **/
@@ -53,13 +53,23 @@
 				data read
  * @note	None
 **/
-#define CSL_Flash_ReadData(__sector, __offset, __type)			(*(__type *)((uint32)(((__sector)*SECTOR_SIZE)+(__offset))))
+#define CSL_Flash_ReadData(__sector, __offset, __type)			(*(__type *)((uint32_t)(((__sector)*FLASH_SECTOR_SIZE)+(__offset))))
 
 /**
  * @brief	Clear Command Complete Interrupt Flags				
 **/
 #define __FLASH_CLEAR_CMD_CPLT_IFLAG()						  	(FTMRE->FSTAT |= FTMRE_FSTAT_CCIF_MASK)
 
+/**
+ * @brief	Wait until Flash Command is Completed(FSTAT[CCIF])
+**/
+#define __FLASH_WAIT_CMD_CPLT()									while(!(FTMRE->FSTAT & FTMRE_FSTAT_CCIF_MASK))
+
+/**
+ * @brief	Clear Access/Protection Error Flags before a new Command
+**/
+#define __FLASH_CLEAR_ERROR_FLAG()								(FTMRE->FSTAT = FTMRE_FSTAT_ACCERR_MASK | FTMRE_FSTAT_FPVIOL_MASK)
+
 /**
  * @brief	Enable/Disbale Command Complete Interrupt(CCIE)
 **/
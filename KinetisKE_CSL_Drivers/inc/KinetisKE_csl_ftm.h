@@ -71,6 +71,7 @@ typedef struct
 #define FTM_CHANNEL_3			0x03u
 #define FTM_CHANNEL_4			0x04u
 #define FTM_CHANNEL_5			0x05u
+#define FTM_CHANNEL_ALL			0x3Fu			//Channel Mask of all Channels(Bit n for FTM_CHANNEL_n)
 
 /**
  * FTM Count Mode
@@ -82,8 +83,8 @@ typedef struct
  * FTM Clock Source
 **/
 #define FTM_CLKSource_DISABLE								0x00u
-#define FTM_CLKSource_SystemCLK								0x04u
-#define FTM_CLKSource_ICSFFCLK								0x08u
+#define FTM_CLKSource_SystemCLK								0x08u
+#define FTM_CLKSource_ICSFFCLK								0x10u
 #define FTM_CLKSource_TCLK									FTM_SC_CLKS_MASK
 
 /**
@@ -114,11 +115,11 @@ typedef struct
 /**
  * FTM Output Compare & PWM Mode
 **/ 
-#define FTM_OC_MATCH_Toggle									0x20u				//if CnV and MOD are in a match, Toggle Channel OUTPUT
-#define FTM_OC_MATCH_SET									0x24u				//if..., Channel Level is High
-#define FTM_OC_MATCH_RESET									0x28u				//if..., Channel Level is low
-#define FTM_OC_PWM_MODE1									0x56u				//if..., PWM level is High
-#define FTM_OC_PWM_MODE2									0x60u				//if..., PWM level is low
+#define FTM_OC_MATCH_Toggle									0x14u				//if CnV and MOD are in a match, Toggle Channel OUTPUT
+#define FTM_OC_MATCH_SET									0x1Cu				//if..., Channel Level is High
+#define FTM_OC_MATCH_RESET									0x18u				//if..., Channel Level is low
+#define FTM_OC_PWM_MODE1									0x28u				//if..., PWM level is High
+#define FTM_OC_PWM_MODE2									0x24u				//if..., PWM level is low
 
 /**
  * FTM Input Capture Polarity
@@ -137,7 +138,10 @@ typedef struct
 /**
  * @brief 	Clear FTM OverFlow Interrupt Flag
 **/
-#define __CSL_FTM_TOIE_CLEAR_FLAG(__HANDLE__)						(CLEAR_BIT(__HANDLE__->Instance->SC, FTM_SC_TOE_MASK))
+#define __CSL_FTM_TOIE_CLEAR_FLAG(__HANDLE__)						{	\
+																		READ_REG(__HANDLE__->Instance->SC); \
+																		CLEAR_BIT(__HANDLE__->Instance->SC, FTM_SC_TOF_MASK); \
+																	}
 
 /**
  * @brief	Enable/Disable Channel Interrupt
@@ -247,6 +251,10 @@ CSL_StatusTypeDef CSL_FTM_OC_Config(FTM_HandleTypeDef* cftm, FTM_OC_InitTypeDef*
 CSL_StatusTypeDef CSL_FTM_PWM_Config(FTM_HandleTypeDef* cftm, FTM_OC_InitTypeDef* sConfig, uint8_t Channel);
 CSL_StatusTypeDef CSL_FTM_IC_Config(FTM_HandleTypeDef* cftm, FTM_IC_InitTypeDef* sConfig, uint8_t Channel);
 
+//Synchronized PWM Update(FTM2 only)
+CSL_StatusTypeDef CSL_FTM_PWM_SyncInit(FTM_HandleTypeDef* cftm, uint8_t ChannelMask);
+CSL_StatusTypeDef CSL_FTM_PWM_SyncUpdate(FTM_HandleTypeDef* cftm, const uint16_t* pPulse, uint8_t ChannelMask);
+
 //Handle Functions
 CSL_FTM_StateTypeDef CSL_FTM_GetState(FTM_HandleTypeDef* cftm);
 
@@ -272,6 +280,8 @@ CSL_FTM_StateTypeDef CSL_FTM_GetState(FTM_HandleTypeDef* cftm);
 														 (ch == FTM_CHANNEL_4) || \
 														 (ch == FTM_CHANNEL_5))
 
+#define IS_FTM_ChannelMask(mask)						((mask != 0u) && ((mask & ~FTM_CHANNEL_ALL) == 0u))
+
 #define IS_FTM_OCMode(oc)								((oc == FTM_OC_MATCH_Toggle) || \
 														 (oc == FTM_OC_MATCH_SET) || \
 														 (oc == FTM_OC_MATCH_RESET) || \
@@ -0,0 +1,156 @@
+/**
+ * Title 	LIN module in CSL for KEAZ128(Header File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+/* LIN 2.x Master/Slave Engine on UART(Break Detection) and one PIT Channel */
+
+#ifndef __KinetisKE_CSL_LIN_H
+#define __KinetisKE_CSL_LIN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /*__cplusplus*/
+
+#include "KinetisKE_csl_uart.h"
+#include "KinetisKE_csl_pit.h"
+
+/**
+ * LIN Engine State
+**/
+typedef enum
+{
+	CSL_LIN_STATE_RESET		= 0x00u,	//Engine is not Initialized
+	CSL_LIN_STATE_READY		= 0x01u,	//Engine is Initialized but stopped
+	CSL_LIN_STATE_IDLE		= 0x02u,	//Waiting for Slot(Master) or Break Field(Slave)
+	CSL_LIN_STATE_BREAK		= 0x03u,	//Break Field sent, waiting for its detection(Master)
+	CSL_LIN_STATE_SYNC		= 0x04u,	//Waiting for Sync Field
+	CSL_LIN_STATE_PID		= 0x05u,	//Waiting for Protected Identifier
+	CSL_LIN_STATE_TX_DATA	= 0x06u,	//Sending Response
+	CSL_LIN_STATE_RX_DATA	= 0x07u,	//Receiving Response
+}LIN_StateTypeDef;
+
+/**
+ * LIN Initialization Structure
+**/
+typedef struct
+{
+	uint8_t					Mode;			//Master or Slave
+	uint8_t					PIT_Channel;	//PIT Channel(Master: Time Base, Slave: Response Timeout)
+	uint16_t				TimeBase;		//Master Time Base in us(Unit of Schedule Slots)
+}LIN_InitTypeDef;
+
+/**
+ * LIN Frame Structure
+**/
+typedef struct
+{
+	uint8_t					Id;				//Frame Identifier(0x00 ~ 0x3F)
+	uint8_t					Direction;		//Publish/Subscribe/Ignore
+	uint8_t					Length;			//Data Length(1 ~ 8)
+	uint8_t					Checksum;		//Classic/Enhanced
+	uint8_t					Data[8];		//Frame Data
+}LIN_FrameTypeDef;
+
+/**
+ * LIN Schedule Table Entry(Master only)
+**/
+typedef struct
+{
+	uint8_t					Id;				//Frame Identifier to be sent
+	uint8_t					Slots;			//Slot Length in Time Base
+}LIN_ScheduleTypeDef;
+
+/**
+ * LIN Handle Structure
+**/
+typedef struct
+{
+	UART_HandleTypeDef*			cuart;			//UART on LIN Bus(initialized as 8N1 by user)
+	LIN_InitTypeDef				Init;			//Initialize Structure
+	LIN_FrameTypeDef*			pFrames;		//Frame Table of this Node
+	uint8_t						FrameCount;		//Frames in Frame Table
+	const LIN_ScheduleTypeDef*	pSchedule;		//Schedule Table in use(Master)
+	uint8_t						ScheduleCount;	//Entries in Schedule Table
+	uint8_t						ScheduleIndex;	//Next Entry to be sent
+	const LIN_ScheduleTypeDef* __IO pNextSchedule;	//Schedule Table taken at next Slot
+	uint8_t						NextScheduleCount;	//Entries in next Schedule Table
+	uint8_t						SlotCount;		//Time Base ticks left in current Slot
+	LIN_FrameTypeDef*			pCurrent;		//Frame being processed
+	uint8_t						PID;			//Protected Identifier of current Frame
+	uint8_t						Index;			//Response Byte Index
+	uint8_t						TxByte;			//Last Byte sent(Readback Check)
+	uint16_t					Sum;			//Checksum Accumulator
+	uint8_t						Buffer[8];		//Receive Buffer of Response
+	__IO LIN_StateTypeDef		State;			//Engine State
+	__IO uint32_t				ErrorCode;		//Error Code
+}LIN_HandleTypeDef;
+
+/**
+ * LIN Node Mode
+**/
+#define LIN_Mode_Slave				0x00u
+#define LIN_Mode_Master				0x01u
+
+/**
+ * LIN Frame Direction(relative to this Node)
+**/
+#define LIN_Frame_Ignore			0x00u		//Header only, Response is not for this Node
+#define LIN_Frame_Publish			0x01u		//This Node sends the Response
+#define LIN_Frame_Subscribe			0x02u		//This Node receives the Response
+
+/**
+ * LIN Checksum Model
+**/
+#define LIN_Checksum_Classic		0x00u		//Data Bytes only(LIN 1.x, Diagnostic Frames)
+#define LIN_Checksum_Enhanced		0x01u		//Data Bytes and PID(LIN 2.x)
+
+/**
+ * LIN Sync Field & Diagnostic Identifiers
+**/
+#define LIN_SYNC_FIELD				0x55u
+#define LIN_ID_MASTER_REQUEST		0x3Cu
+#define LIN_ID_SLAVE_RESPONSE		0x3Du
+
+/**
+ * Error Codes of LIN
+**/
+#define CSL_LIN_ERROR_NONE			0x00000000U		/*!< No error							*/
+#define CSL_LIN_ERROR_BIT			0x00000001U		/*!< Readback differs from sent Byte	*/
+#define CSL_LIN_ERROR_SYNC			0x00000002U		/*!< Sync Field is not 0x55				*/
+#define CSL_LIN_ERROR_PID			0x00000004U		/*!< PID Parity error					*/
+#define CSL_LIN_ERROR_CHECKSUM		0x00000008U		/*!< Checksum error						*/
+#define CSL_LIN_ERROR_TIMEOUT		0x00000010U		/*!< Response is not completed in time	*/
+#define CSL_LIN_ERROR_NORESPONSE	0x00000020U		/*!< No Response Byte received			*/
+#define CSL_LIN_ERROR_UART			0x00000040U		/*!< Framing/Noise/Overrun error		*/
+#define CSL_LIN_ERROR_CONFIG		0x00000080U		/*!< Configure Failed					*/
+
+/** LIN Public Functions **/
+CSL_StatusTypeDef CSL_LIN_Init(LIN_HandleTypeDef* clin);
+CSL_StatusTypeDef CSL_LIN_DeInit(LIN_HandleTypeDef* clin);
+CSL_StatusTypeDef CSL_LIN_SetSchedule(LIN_HandleTypeDef* clin, const LIN_ScheduleTypeDef* pSchedule, uint8_t Count);
+CSL_StatusTypeDef CSL_LIN_Start(LIN_HandleTypeDef* clin);
+CSL_StatusTypeDef CSL_LIN_Stop(LIN_HandleTypeDef* clin);
+uint8_t CSL_LIN_GetPID(uint8_t Id);
+
+//Interrupt Service Requestion and Callbacks
+void CSL_LIN_IRQHandler(LIN_HandleTypeDef* clin);
+void CSL_LIN_PIT_IRQHandler(LIN_HandleTypeDef* clin);
+void CSL_LIN_FrameCpltCallback(LIN_HandleTypeDef* clin, LIN_FrameTypeDef* pFrame);
+void CSL_LIN_ErrorCallback(LIN_HandleTypeDef* clin);
+
+/* Defgroup LIN_Private_Macros */
+#define IS_LIN_Mode(mode)			((mode == LIN_Mode_Slave) || (mode == LIN_Mode_Master))
+#define IS_LIN_PIT_Channel(ch)		((ch == PIT_CHANNEL_0) || (ch == PIT_CHANNEL_1))
+#define IS_LIN_ID(id)				(id <= 0x3Fu)
+#define IS_LIN_Length(len)			((len >= 1u) && (len <= 8u))
+
+#ifdef __cplusplus
+ }
+#endif /*__cplusplus*/
+
+#endif /*__KinetisKE_CSL_LIN_H*/
+
+//EOF
@@ -26,6 +26,7 @@ typedef struct
 	uint8_t Match;				//Enable Match or not
 	uint8_t MatchValue;			//Match Value
 	uint16_t Pins;				//Pin Group
+	uint32_t BaudRate;			//Target SCK in Hz(PreScaler & Scaler are solved), 0 to use them as given
 }SPI_InitTypeDef;
 
 /**
@@ -42,6 +43,59 @@ typedef enum
 	CSL_SPI_STATE_ERROR			= 0x06u,
 }SPI_StateTypeDef;
 
+/**
+ * SPI Device Settings of Queued Transactions
+ * CS_Pin must be configured as GPIO Output & driven High before the first Transaction,
+ * the Queue only writes CS_Port->PCOR/PSOR
+**/
+typedef struct
+{
+	uint8_t					CLKPolarity;	//Clock Polarity
+	uint8_t					CLKPhase;		//Clock Phase
+	uint8_t					PreScaler;		//BaudRate PreScaler
+	uint8_t					Scaler;			//BaudRate Scaler
+	uint32_t				BaudRate;		//Target SCK in Hz(solved from Bus Clock), 0 to use PreScaler & Scaler
+	FGPIO_Type*				CS_Port;		//Chip Select Port(active Low), NULL if not used
+	uint32_t				CS_Pin;			//Chip Select Pin Mask
+}SPI_DeviceTypeDef;
+
+/**
+ * SPI Slave Streaming Structure
+**/
+typedef struct
+{
+	uint8_t*				pRing;			//Receive Ring Buffer, NULL if Streaming is stopped
+	uint16_t				Mask;			//Ring Size - 1(Size is Power of 2)
+	__IO uint16_t			Head;			//Producer Index(ISR, free running)
+	__IO uint16_t			Tail;			//Consumer Index(free running)
+	__IO uint32_t			Overflow;		//Bytes dropped because Ring is full
+	const uint8_t*			pTx[2];			//Response Banks
+	uint16_t				TxSize[2];		//Size of Response Banks
+	__IO uint8_t			Active;			//Bank being served
+	__IO Flag_Status		Staged;			//SET if the other Bank waits for next Frame
+	__IO uint16_t			TxIndex;		//Next Byte of Active Bank
+	__IO uint32_t			Underrun;		//Frames started before a Response is staged
+	uint8_t					IdleByte;		//Sent when no Response is available
+}SPI_SlaveTypeDef;
+
+struct __SPI_HandleTypeDef;
+
+/**
+ * SPI Queued Transaction Descriptor
+**/
+typedef struct __SPI_TransferTypeDef
+{
+	const SPI_DeviceTypeDef*	pDevice;	//Device addressed by this Transaction
+	const uint8_t*			pCmd;			//Command Phase(sent first, received Bytes discarded), NULL if not used
+	uint8_t					CmdSize;		//Size of Command Phase
+	const uint8_t*			pTxData;		//Data to be sent, NULL to send 0xFF
+	uint8_t*				pRxData;		//Buffer of received Data, NULL to discard
+	uint16_t				Size;			//Size of Data Phase
+	void					(*Callback)(struct __SPI_HandleTypeDef*, struct __SPI_TransferTypeDef*);	//Completion Callback(in ISR)
+	void*					pContext;		//User Context
+	__IO CSL_StatusTypeDef	Status;			//CSL_Busy while queued, CSL_OK or CSL_Error when done
+}SPI_TransferTypeDef;
+
 /**
  * SPI Handler Structure
 **/
@@ -52,11 +106,25 @@ typedef struct __SPI_HandleTypeDef
 	uint8_t* 				pTxBuffer;
 	uint16_t 				pTxXferCount;
 	uint16_t 				pTxXferSize;
+	const CSL_IOVecTypeDef*	pTxVec;			//Next Segment of Vectored Transmit
+	uint8_t					TxVecCount;		//Segments left after current one
+	const uint8_t*			pTxTable;		//Symbol Table of Table Transmit, NULL if not used
+	uint8_t					TxTableWidth;	//Symbol Bytes per Data Byte
+	uint8_t					TxSymbol;		//Next Symbol Byte of current Data Byte
 	uint8_t* 				pRxBuffer;
 	uint16_t 				pRxXferCount;
 	uint16_t 				pRxXferSize;
 	void 					(*TxISR)(struct __SPI_HandleTypeDef*);
 	void					(*RxISR)(struct __SPI_HandleTypeDef*);
+	uint16_t				RxSkip;			//Received Bytes discarded before storing(Command Phase)
+	SPI_TransferTypeDef*	pQueue[SPI_QUEUE_DEPTH];	//Transaction Queue
+	__IO uint8_t			QHead;			//Queue Producer Index(free running)
+	__IO uint8_t			QTail;			//Queue Consumer Index(free running)
+	SPI_TransferTypeDef* __IO	pXfer;		//Transaction in progress
+	const SPI_DeviceTypeDef*	pDevice;	//Device Settings in SPIx->C1 & SPIx->BR
+	uint32_t				BusClock;		//Bus Clock the BaudRate was solved for
+	CSL_IOVecTypeDef		XferVec;		//Data Phase following Command Phase
+	SPI_SlaveTypeDef		Slave;			//Slave Streaming
 	__IO SPI_StateTypeDef	gState;
 	__IO uint8_t			ErrorCode;
 	__IO CSL_LockTypeDef 	Lock;
@@ -197,6 +265,21 @@ CSL_StatusTypeDef CSL_SPI_TransmitReceive(SPI_HandleTypeDef* cspi, uint8_t* TxBu
 CSL_StatusTypeDef CSL_SPI_Transmit_IT(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, uint16_t Size);
 CSL_StatusTypeDef CSL_SPI_Receive_IT(SPI_HandleTypeDef* cspi, uint8_t* RxBuffer, uint16_t Size);
 CSL_StatusTypeDef CSL_SPI_TransmitReceive_IT(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t Size);
+CSL_StatusTypeDef CSL_SPI_TransmitV_IT(SPI_HandleTypeDef* cspi, const CSL_IOVecTypeDef* pVec, uint8_t Count);
+CSL_StatusTypeDef CSL_SPI_TransmitTable_IT(SPI_HandleTypeDef* cspi, const uint8_t* TxBuffer, uint16_t Size, const uint8_t* pTable, uint8_t Width);
+
+/* SPI Transaction Queue Functions */
+CSL_StatusTypeDef CSL_SPI_Submit(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer);
+CSL_StatusTypeDef CSL_SPI_Cancel(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer);
+uint8_t CSL_SPI_GetQueueCount(SPI_HandleTypeDef* cspi);
+
+/* SPI Slave Streaming Functions */
+CSL_StatusTypeDef CSL_SPI_SlaveStart_IT(SPI_HandleTypeDef* cspi, uint8_t* RingBuffer, uint16_t Size, uint8_t IdleByte);
+CSL_StatusTypeDef CSL_SPI_SlaveStop(SPI_HandleTypeDef* cspi);
+CSL_StatusTypeDef CSL_SPI_SlaveStage(SPI_HandleTypeDef* cspi, const uint8_t* pData, uint16_t Size);
+uint16_t CSL_SPI_SlaveRead(SPI_HandleTypeDef* cspi, uint8_t* pData, uint16_t Size);
+uint32_t CSL_SPI_GetSlaveUnderrun(SPI_HandleTypeDef* cspi);
+uint32_t CSL_SPI_GetSlaveOverflow(SPI_HandleTypeDef* cspi);
 
 /* SPI Interrupt Functions */
 void CSL_SPI_IRQHandler(SPI_HandleTypeDef* cspi);
@@ -210,6 +293,7 @@ void CSL_SPI_MatchCallback(SPI_HandleTypeDef* cspi);
 SPI_StateTypeDef CSL_SPI_GetState(SPI_HandleTypeDef* cspi);
 uint8_t CSL_SPI_GetError(SPI_HandleTypeDef* cspi);
 uint32_t CSL_SPI_GetBaudRate(SPI_HandleTypeDef* cspi);
+uint32_t CSL_SPI_CalcBaudRate(uint32_t BusClock, uint32_t BaudRate, uint8_t* PreScaler, uint8_t* Scaler);
 uint8_t CSL_SPI_GetMatchValue(SPI_HandleTypeDef* cspi);
 void CSL_SPI_SetMatchValue(SPI_HandleTypeDef* cspi, uint8_t match);
 
@@ -225,6 +309,8 @@ void CSL_SPI_SetMatchValue(SPI_HandleTypeDef* cspi, uint8_t match);
 #define IS_SPI_BAUDRATESC(sc)				(((sc+1) >= 0x01u) && (sc <= 0x08u))
 #define IS_SPI0_PINS(pin)					((pin == SPI0_PIN_GROUP0) ||(pin == SPI0_PIN_GROUP1))
 #define IS_SPI1_PINS(pin)					((pin == SPI1_PIN_GROUP0) ||(pin == SPI1_PIN_GROUP1))
+#define IS_SPI_RingSize(size)				((size >= 2u) && (size <= 0x8000u) && ((size & (size - 1u)) == 0u))
+#define IS_SPI_QUEUE_DEPTH(depth)			((depth >= 2u) && (depth <= 128u) && ((depth & (depth - 1u)) == 0u))
 
 #endif /*__KinetisKE_CSL_SPI_H*/
 
@@ -0,0 +1,126 @@
+/**
+ * Title 	SPI Extra Functions in CSL for KEAZxxx(Header File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+/* JEDEC SPI NOR Flash(3-Byte Address) on SPI Transaction Queue */
+/* WS2812 LED Strip encoded on MOSI through a Symbol Table */
+
+#ifndef __KinetisKE_CSL_SPI_EX_H
+#define __KinetisKE_CSL_SPI_EX_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /*__cplusplus*/
+
+#include "KinetisKE_csl_spi.h"
+
+/**
+ * SPI NOR Flash State
+**/
+typedef enum
+{
+	CSL_SPI_NOR_STATE_RESET		= 0x00u,	//Flash is not probed
+	CSL_SPI_NOR_STATE_READY		= 0x01u,	//Flash is probed and idle
+	CSL_SPI_NOR_STATE_BUSY		= 0x02u,	//Read/Program/Erase in progress
+	CSL_SPI_NOR_STATE_ERROR		= 0x03u,	//Probe failed
+}SPI_NOR_StateTypeDef;
+
+/**
+ * SPI NOR Flash Handle
+**/
+typedef struct __SPI_NOR_HandleTypeDef
+{
+	SPI_HandleTypeDef*			cspi;			//SPI Master(initialized by CSL_SPI_Init())
+	SPI_DeviceTypeDef			Device;			//Clock Mode, BaudRate & Chip Select of Flash
+	uint32_t					JEDEC_ID;		//Manufacturer, Memory Type & Capacity(0x00MMTTCC)
+	uint32_t					Capacity;		//Flash Size in Bytes
+	uint8_t						Operation;		//Operation in progress
+	uint32_t					Address;		//Flash Address of next Chunk
+	const uint8_t*				pSrc;			//Source of next Page(Program)
+	uint8_t*					pDst;			//Destination of next Chunk(Read)
+	uint32_t					Remain;			//Bytes left after queued Chunk
+	uint32_t					Done;			//Bytes of the Operation completed(read or programmed)
+	uint8_t						PageIndex;		//Page Descriptor to be prepared next
+	Flag_Status					Prepared;		//SET if next Page is prepared during Status Polling
+	SPI_TransferTypeDef			XferWren;		//Write Enable
+	SPI_TransferTypeDef			XferPage[2];	//Ping-Pong Read/Program/Erase Descriptors
+	SPI_TransferTypeDef			XferPoll;		//Read Status Register
+	SPI_TransferTypeDef*		pQueued;		//Page Descriptor last queued
+	uint8_t						Cmd[2][5];		//Opcode, Address & Dummy of XferPage
+	uint8_t						Status;			//Status Register read by XferPoll
+	__IO SPI_NOR_StateTypeDef	State;			//Flash State
+	__IO CSL_StatusTypeDef		Result;			//Result of last Operation
+}SPI_NOR_HandleTypeDef;
+
+/**
+ * SPI NOR Flash Commands
+**/
+#define SPI_NOR_CMD_WREN			0x06u		//Write Enable
+#define SPI_NOR_CMD_RDSR			0x05u		//Read Status Register
+#define SPI_NOR_CMD_RDID			0x9Fu		//Read JEDEC ID
+#define SPI_NOR_CMD_FAST_READ		0x0Bu		//Fast Read(one Dummy Byte)
+#define SPI_NOR_CMD_PP				0x02u		//Page Program
+#define SPI_NOR_CMD_SE				0x20u		//Sector Erase(4KB)
+#define SPI_NOR_CMD_BE				0xD8u		//Block Erase(64KB)
+#define SPI_NOR_CMD_CE				0xC7u		//Chip Erase
+
+/**
+ * SPI NOR Flash Geometry
+**/
+#define SPI_NOR_PAGE_SIZE			0x100u
+#define SPI_NOR_SECTOR_SIZE			0x1000u
+#define SPI_NOR_BLOCK_SIZE			0x10000u
+#define SPI_NOR_SR_WIP				0x01u		//Status Register: Write in Progress
+
+/**
+ * SPI NOR Flash Erase Size
+**/
+#define SPI_NOR_Erase_Sector		SPI_NOR_CMD_SE
+#define SPI_NOR_Erase_Block			SPI_NOR_CMD_BE
+#define SPI_NOR_Erase_Chip			SPI_NOR_CMD_CE
+
+/**
+ * SPI NOR Flash Operations
+**/
+#define SPI_NOR_Op_None				0x00u
+#define SPI_NOR_Op_Read				0x01u
+#define SPI_NOR_Op_Program			0x02u
+#define SPI_NOR_Op_Erase			0x03u
+
+/**
+ * WS2812 LED Strip
+ * Each LED Bit is 3 SCK on MOSI: 1 --> 110, 0 --> 100
+**/
+#define SPI_LED_BAUDRATE			2500000u	//1.2us per LED Bit, T0H = 0.4us, T1H = 0.8us
+#define SPI_LED_BAUDRATE_MIN		2000000u	//Slowest SCK inside WS2812 Timing Tolerance
+#define SPI_LED_BAUDRATE_MAX		3000000u	//Fastest SCK inside WS2812 Timing Tolerance
+#define SPI_LED_SYMBOL_WIDTH		0x03u		//SPI Bytes per Colour Byte
+
+/* Functions for SPI NOR Flash */
+CSL_StatusTypeDef CSL_SPIEx_NOR_Init(SPI_NOR_HandleTypeDef* cnor, uint32_t Timeout);
+CSL_StatusTypeDef CSL_SPIEx_NOR_Read(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, uint8_t* pData, uint32_t Size);
+CSL_StatusTypeDef CSL_SPIEx_NOR_Program(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, const uint8_t* pData, uint32_t Size);
+CSL_StatusTypeDef CSL_SPIEx_NOR_Erase(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, uint8_t EraseSize);
+SPI_NOR_StateTypeDef CSL_SPIEx_NOR_GetState(SPI_NOR_HandleTypeDef* cnor);
+
+//Callbacks(in SPIx ISR)
+void CSL_SPIEx_NOR_CpltCallback(SPI_NOR_HandleTypeDef* cnor);
+void CSL_SPIEx_NOR_ErrorCallback(SPI_NOR_HandleTypeDef* cnor);
+
+/* Functions for WS2812 LED Strip */
+CSL_StatusTypeDef CSL_SPIEx_LED_Init(SPI_HandleTypeDef* cspi);
+CSL_StatusTypeDef CSL_SPIEx_LED_Show(SPI_HandleTypeDef* cspi, const uint8_t* pGRB, uint16_t Count);
+
+/* Private Macros for SPI NOR parameters check */
+#define IS_SPI_NOR_Erase(size)		((size == SPI_NOR_Erase_Sector) || (size == SPI_NOR_Erase_Block) || (size == SPI_NOR_Erase_Chip))
+
+#ifdef __cplusplus
+ }
+#endif /*__cplusplus*/
+
+#endif /*__KinetisKE_CSL_SPI_EX_H*/
+
+//EOF
@@ -89,22 +89,96 @@ typedef struct
 }UART_InitTypeDef;
 
 /**
- * UART Handle Structure
+ * UART Ring Buffer Structure
+ * @note	Single Producer & Single Consumer, Head is only written by producer
+ *			and Tail is only written by consumer, so no interrupt masking is needed
+**/
+typedef struct
+{
+	uint8_t*						pBuffer;		//Ring Storage(supplied by user)
+	uint16_t						Mask;			//Size of Ring - 1(Size is power of 2)
+	__IO uint16_t					Head;			//Write Index(free-running)
+	__IO uint16_t					Tail;			//Read Index(free-running)
+	__IO uint16_t					HighWater;		//Max Bytes ever held in Ring
+	__IO uint32_t					Overflow;		//Bytes dropped because Ring is full
+}UART_RingTypeDef;
+
+#if (UART_STATISTICS_STAT == 0x01u)
+/**
+ * UART Statistics Structure
+**/
+typedef struct
+{
+	uint32_t						TxBytes;			//Data Words transmitted
+	uint32_t						RxBytes;			//Data Words received
+	uint32_t						OverrunErrors;		//UARTx->S1[OR]
+	uint32_t						NoiseErrors;		//UARTx->S1[NF]
+	uint32_t						FramingErrors;		//UARTx->S1[FE]
+	uint32_t						ParityErrors;		//UARTx->S1[PF]
+	uint32_t						TxCpltCallbacks;	//CSL_UART_TxCpltCallback()
+	uint32_t						RxCpltCallbacks;	//CSL_UART_RxCpltCallback()
+	uint32_t						RxEventCallbacks;	//CSL_UART_RxEventCallback()
+	uint32_t						ErrorCallbacks;		//CSL_UART_ErrorCallback()
+	uint32_t						IdleCallbacks;		//CSL_UART_IDLECallback()
+	uint32_t						RxLevelCallbacks;	//CSL_UART_RxLevelCallback()
+	uint32_t						LinBreakCallbacks;	//CSL_UART_LIN_BKPCallback()
+	uint32_t						IRQCount;			//CSL_UART_IRQHandler() calls
+	uint32_t						IRQMaxCycles;		//Worst-case IRQHandler duration(Core Clocks)
+	__IO uint32_t					Sequence;			//Changed by every IRQHandler call
+}UART_StatsTypeDef;
+#endif /*UART_STATISTICS_STAT == 0x01u*/
+
+/**
+ * UART RS-485 Driver Enable Structure
+ * @note	DE_Port is NULL for UARTs without RS-485 Transceiver
 **/
 typedef struct
+{
+	FGPIO_Type*						DE_Port;		//FGPIO Port of DE Pin(FGPIOA/FGPIOB/FGPIOC)
+	uint32_t						DE_Pin;			//DE Pin(GPIOx_Pin_PTxx)
+	uint8_t							DE_Polarity;	//Active Level of DE
+	uint8_t							LeadGuard;		//Idle Characters between DE asserted and first Start Bit
+	uint8_t							TailGuard;		//Idle Characters between last Stop Bit and DE released
+	FunctionalState					RxDisable;		//Receiver is off while DE is asserted(no local Echo)
+	__IO uint8_t					Phase;			//Transmit Phase(Idle/Lead/Data/Tail)
+	__IO uint8_t					GuardCount;		//Idle Characters left in current Guard
+}UART_RS485TypeDef;
+
+/**
+ * UART Handle Structure
+**/
+typedef struct __UART_HandleTypeDef
 {
 	UART_Type*						Instance;		//Instance of UART
 	UART_InitTypeDef				Init;			//Initialize Structure
 	uint8_t* 						pTxBuffer;		//Transmit Buffer
 	uint16_t						pTxXferSize;	//Size of Tx Buffer
 	__IO uint16_t 					pTxXferCount;	//Counter of Tx Buffer
+	const CSL_IOVecTypeDef*			pTxVec;			//Next Segment of Vectored Transmit
+	__IO uint8_t					TxVecCount;		//Segments left after current one
+	UART_RingTypeDef				TxRing;			//Transmit Ring Buffer
+	__IO uint8_t					TxMode;			//Transmit Mode
+	__IO CSL_LockTypeDef			TxLock;			//Producer Lock of Transmit Ring
+	UART_RS485TypeDef				RS485;			//RS-485 Driver Enable
 	uint8_t* 						pRxBuffer;		//Receive Buffer
 	uint16_t						pRxXferSize;	//Size of Rx Buffer
 	__IO uint16_t 					pRxXferCount;	//Counter of Rx Buffer
+	UART_RingTypeDef				RxRing;			//Receive Ring Buffer
+	uint8_t*						pRxFrame[2];	//Ping-Pong Buffers of IDLE Reception
+	__IO uint8_t					RxFrameIndex;	//Buffer currently being filled
+	__IO uint8_t					RxMode;			//Receive Mode
+	uint8_t							RxNodeAddress;	//Node Address of Address-filtered Reception
+	uint16_t						RxBroadcast;	//Broadcast Address, UART_Address_None if not used
+	__IO uint8_t					RxAddress;		//Address of the Frame being received
 	__IO CSL_LockTypeDef			Lock;			//Process Lock
 	__IO CSL_UART_StateTypeDef 		gState;			//Global State
 	__IO CSL_UART_StateTypeDef		RxState;		//Receiver State
 	__IO uint32_t					ErrorCode;		//Error Code 
+	void							(*TxISR)(struct __UART_HandleTypeDef*);	//Per-byte Transmit Handler
+	void							(*RxISR)(struct __UART_HandleTypeDef*);	//Per-byte Receive Handler
+#if (UART_STATISTICS_STAT == 0x01u)
+	UART_StatsTypeDef				Stats;			//Statistics
+#endif /*UART_STATISTICS_STAT == 0x01u*/
 }UART_HandleTypeDef;
 
 /**
@@ -156,6 +230,39 @@ typedef struct
 #define UART_Wakeup_Wire			0x00u
 #define UART_Wakeup_Address			0x08u
 
+/**
+ * UART RS-485 DE Polarity
+**/
+#define UART_RS485_DE_High			0x00u		//DE is active High
+#define UART_RS485_DE_Low			0x01u		//DE is active Low
+
+/**
+ * UART RS-485 Transmit Phase
+**/
+#define UART_RS485_Phase_Idle		0x00u		//DE released
+#define UART_RS485_Phase_Lead		0x01u		//DE asserted, sending Lead Guard
+#define UART_RS485_Phase_Data		0x02u		//DE asserted, sending Data
+#define UART_RS485_Phase_Tail		0x03u		//DE asserted, sending Tail Guard
+
+/**
+ * UART Transmit Mode in IT
+**/
+#define UART_TxMode_Buffer			0x00u		//Transmit from linear Buffer, stop when empty
+#define UART_TxMode_Ring			0x01u		//Transmit from Ring Buffer filled by CSL_UART_Write()
+
+/**
+ * UART Receive Mode in IT
+**/
+#define UART_RxMode_Buffer			0x00u		//Receive into linear Buffer, stop when full
+#define UART_RxMode_Ring			0x01u		//Receive into Ring Buffer continuously
+#define UART_RxMode_Idle			0x02u		//Receive Frames delimited by IDLE Line
+#define UART_RxMode_Address			0x03u		//Receive Frames addressed to this Node(9 bit Address Mark)
+
+/**
+ * UART Broadcast Address of Address-filtered Reception
+**/
+#define UART_Address_None			0x0100u		//No Broadcast Address, only Node Address is accepted
+
 /**
  * UART Interrupt Flags Bits
 **/
@@ -193,13 +300,13 @@ typedef struct
  * @brief	Enable/Disable Idle Detection
 **/
 #define __CSL_UART_ENABLE_IDLE(__HANDLE__)				(SET_BIT((__HANDLE__)->Instance->S2, UART_S2_RWUID_MASK))
-#define __CSL_UART_DISABLE_IDLE(__HANDLE__)				(CLEAR_BIT((__HANDLE__)->Instance->S2, UART_S2_PWUID_MASK))
+#define __CSL_UART_DISABLE_IDLE(__HANDLE__)				(CLEAR_BIT((__HANDLE__)->Instance->S2, UART_S2_RWUID_MASK))
 
 /**
  * @brief	    Clear Interrupt Flags(only for UARTx->S2)
 **/
-#define __CSL_UART_CLEAR_LBKDIF(__HANDLE__)				(CLEAR_BIT((__HANDLE__)->Instance->S2, UART_Rx_LBK))
-#define __CSL_UART_CLEAR_RXEDGIF(__HANDLE__)			(CLEAR_BIT((__HANDLE__)->Instance->S2, UART_Rx_Edge))
+#define __CSL_UART_CLEAR_LBKDIF(__HANDLE__)				((__HANDLE__)->Instance->S2 = ((__HANDLE__)->Instance->S2 & ~UART_S2_RXEDGIF_MASK) | UART_Rx_LBK)
+#define __CSL_UART_CLEAR_RXEDGIF(__HANDLE__)			((__HANDLE__)->Instance->S2 = ((__HANDLE__)->Instance->S2 & ~UART_Rx_LBK) | UART_Rx_Edge)
 
 /**
  * @brief 	Flush the DR
@@ -227,6 +334,7 @@ CSL_StatusTypeDef CSL_UART_Init(UART_HandleTypeDef* cuart);
 CSL_StatusTypeDef CSL_UART_DeInit(UART_HandleTypeDef* cuart);
 CSL_StatusTypeDef CSL_UART_HalfDuplex_Init(UART_HandleTypeDef* cuart);
 CSL_StatusTypeDef CSL_UART_MultiProcessorInit(UART_HandleTypeDef* cuart, uint8_t WakeUp);
+CSL_StatusTypeDef CSL_UART_RS485_Init(UART_HandleTypeDef* cuart);
 void CSL_UART_MspInit(UART_HandleTypeDef* cuart);
 void CSL_UART_MspDeInit(UART_HandleTypeDef* cuart);
 
@@ -236,8 +344,29 @@ CSL_StatusTypeDef CSL_UART_Receive(UART_HandleTypeDef* cuart, uint8_t* RxBuffer,
 
 //Fucntions in IT
 CSL_StatusTypeDef CSL_UART_Transmit_IT(UART_HandleTypeDef* cuart, uint8_t* TxBuffer, uint16_t Size);
+CSL_StatusTypeDef CSL_UART_TransmitV_IT(UART_HandleTypeDef* cuart, const CSL_IOVecTypeDef* pVec, uint8_t Count);
 CSL_StatusTypeDef CSL_UART_Receive_IT(UART_HandleTypeDef* cuart, uint8_t* RxBuffer, uint16_t Size);
 
+//Ring Buffer Reception
+CSL_StatusTypeDef CSL_UART_ReceiveToRing_IT(UART_HandleTypeDef* cuart, uint8_t* RingBuffer, uint16_t Size);
+uint16_t CSL_UART_Read(UART_HandleTypeDef* cuart, uint8_t* pData, uint16_t Size);
+uint16_t CSL_UART_GetRxCount(UART_HandleTypeDef* cuart);
+uint16_t CSL_UART_GetRxHighWater(UART_HandleTypeDef* cuart);
+uint32_t CSL_UART_GetRxOverflow(UART_HandleTypeDef* cuart);
+
+//IDLE Line delimited Reception
+CSL_StatusTypeDef CSL_UART_ReceiveToIdle_IT(UART_HandleTypeDef* cuart, uint8_t* Buffer0, uint8_t* Buffer1, uint16_t Size);
+void CSL_UART_RxEventCallback(UART_HandleTypeDef* cuart, uint8_t* pFrame, uint16_t Length);
+
+//Address-filtered Reception(Multi-Processor)
+CSL_StatusTypeDef CSL_UART_ReceiveAddressed_IT(UART_HandleTypeDef* cuart, uint8_t* Buffer0, uint8_t* Buffer1, uint16_t Size, uint8_t Address, uint16_t Broadcast);
+
+//Ring Buffer Transmission
+CSL_StatusTypeDef CSL_UART_TransmitFromRing_IT(UART_HandleTypeDef* cuart, uint8_t* RingBuffer, uint16_t Size);
+CSL_StatusTypeDef CSL_UART_Write(UART_HandleTypeDef* cuart, const uint8_t* pData, uint16_t Size);
+uint16_t CSL_UART_GetTxHighWater(UART_HandleTypeDef* cuart);
+uint32_t CSL_UART_GetTxOverflow(UART_HandleTypeDef* cuart);
+
 //UART Abortion
 void CSL_UART_Abort(UART_HandleTypeDef* cuart);
 void CSL_UART_AbortCallback(UART_HandleTypeDef* cuart);
@@ -258,6 +387,12 @@ CSL_StatusTypeDef CSL_UART_HalfDuplex_ReceiverEnable(UART_HandleTypeDef* cuart);
 CSL_UART_StateTypeDef CSL_UART_GetState(UART_HandleTypeDef* cuart);
 uint32_t CSL_UART_GetError(UART_HandleTypeDef* cuart);
 
+//Statistics
+#if (UART_STATISTICS_STAT == 0x01u)
+void CSL_UART_GetStatistics(UART_HandleTypeDef* cuart, UART_StatsTypeDef* pStats);
+void CSL_UART_ResetStatistics(UART_HandleTypeDef* cuart);
+#endif /*UART_STATISTICS_STAT == 0x01u*/
+
 /* Defgroup UART_Private_Macros CORTEX Private Macros */
 #define IS_UART_UARTx(Instance)		((Instance == UART0) || (Instance == UART1) || (Instance == UART2))
 #define IS_UART0_Pins(UART_Pin)		((UART_Pin == UART0_Pin_Group0) || (UART_Pin == UART0_Pin_Group1))
@@ -267,6 +402,8 @@ uint32_t CSL_UART_GetError(UART_HandleTypeDef* cuart);
 #define IS_UART_WordLength(len)		((len == UART_Word_8B) || (len == UART_Word_9B))
 #define IS_UART_Parity(parity)		((parity == 0x00u) || (parity == 0x02u) || (parity == 0x03u))
 #define IS_UART_Wakeup(x)			((x == 0x00u) || (x == 0x08u))
+#define IS_UART_RS485_DE(pol)		((pol == UART_RS485_DE_High) || (pol == UART_RS485_DE_Low))
+#define IS_UART_RingSize(size)		((size >= 2u) && (size <= 0x8000u) && ((size & (size - 1u)) == 0u))
 
 #ifdef __cplusplus
  }
@@ -0,0 +1,68 @@
+/**
+ * Title 	UART Extra Functions in CSL for KEAZxxx(Header File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+#ifndef __KinetisKE_CSL_UART_EX_H
+#define __KinetisKE_CSL_UART_EX_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif /*__cplusplus*/
+
+#include "KinetisKE_csl_uart.h"
+#include "KinetisKE_csl_pwt.h"
+
+/**
+ * Auto-BaudRate Detection State
+**/
+typedef enum
+{
+	CSL_UART_AUTOBAUD_RESET		= 0x00u,	//Detection is not started
+	CSL_UART_AUTOBAUD_WAIT		= 0x01u,	//Waiting for Start Bit Edge of Sync Character
+	CSL_UART_AUTOBAUD_MEASURE	= 0x02u,	//PWT is measuring Periods of Sync Character
+	CSL_UART_AUTOBAUD_DONE		= 0x03u,	//BaudRate is programmed
+}UART_AutoBaudStateTypeDef;
+
+/**
+ * Auto-BaudRate Detection Handle
+**/
+typedef struct
+{
+	UART_HandleTypeDef*			cuart;			//UART to be detected(initialized by CSL_UART_Init())
+	uint32_t					MinBaudRate;	//Lowest BaudRate expected(selects PWT Prescaler)
+	uint16_t					MaxError;		//Max Residual Error in 0.01% before falling back
+	uint32_t					MeasuredBaud;	//BaudRate measured from Sync Character
+	uint32_t					BaudRate;		//BaudRate programmed in SBR
+	int16_t						Error;			//Residual Error of BaudRate in 0.01%
+	Flag_Status					Fallback;		//SET if nearest standard BaudRate is used
+	uint32_t					Sum;			//Sum of measured Periods
+	uint16_t					First;			//First measured Period
+	uint8_t						Count;			//Periods measured
+	uint8_t						Prescaler;		//PWT Prescaler(2^n)
+	__IO UART_AutoBaudStateTypeDef	State;		//Detection State
+}UART_AutoBaudTypeDef;
+
+/**
+ * Sync Character of Auto-BaudRate Detection
+ * 0x55 toggles on every Bit, falling Edges come every 2 Bits
+**/
+#define UART_AUTOBAUD_SYNC			0x55u
+#define UART_AUTOBAUD_PERIODS		0x03u		//Falling-to-Falling Periods measured after Start Bit
+
+/* Functions for UART Extra Functions */
+CSL_StatusTypeDef CSL_UARTEx_AutoBaud_Start(UART_AutoBaudTypeDef* cab);
+CSL_StatusTypeDef CSL_UARTEx_AutoBaud_Stop(UART_AutoBaudTypeDef* cab);
+void CSL_UARTEx_AutoBaud_IRQHandler(UART_AutoBaudTypeDef* cab);
+void CSL_UARTEx_AutoBaud_PWT_IRQHandler(UART_AutoBaudTypeDef* cab);
+void CSL_UARTEx_AutoBaudCpltCallback(UART_AutoBaudTypeDef* cab);
+
+#ifdef __cplusplus
+ }
+#endif /*__cplusplus*/
+
+#endif /*__KinetisKE_CSL_UART_EX_H*/
+
+//EOF
@@ -12,6 +12,8 @@
 **/
 static void ADC_Config(ADC_HandleTypeDef* cadc);
 static void ADC_SetChannel(ADC_HandleTypeDef* cadc);
+static uint32_t ADC_GetTimestamp(void);
+static void ADC_StreamISR(ADC_HandleTypeDef* cadc);
 
 
 /* Public Functions */
@@ -124,6 +126,221 @@ uint16_t CSL_ADC_GetSingleValue(ADC_HandleTypeDef* cadc)
 	return ADC->R;
 }
 
+/**
+ * @brief	Get Values out of ADC Result FIFO(blocking)
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @param	uint16_t* pBuffer
+				Destination Buffer, Values are in order of FIFO.Channel[]
+ * @param	uint8_t Size
+				Values to read(1 ~ FIFO Depth)
+ * @return	CSL_StatusTypeDef
+ * @note	Conversion must be started by Continuous Mode or Hardware Trigger,
+ *			this function waits until the Result FIFO is full.
+**/
+CSL_StatusTypeDef CSL_ADC_GetFIFOValues(ADC_HandleTypeDef* cadc, uint16_t* pBuffer, uint8_t Size)
+{
+	uint8_t i = 0u;
+	
+	//Parameters Check
+	if((cadc == NULL) || (pBuffer == NULL) || (Size == 0u) || (Size > cadc->FIFO.Depth + 1u))
+	{
+		return CSL_Error;
+	}
+	
+	//Result FIFO belongs to ISR of Streaming/Oversampling/Monitor/Sequence
+	if(cadc->gState >= CSL_ADC_STATE_STREAM)
+	{
+		return CSL_Busy;
+	}
+	
+	//COCO is SET when Result FIFO is full
+	while(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == RESET)
+		;
+	
+	//every Read pops one Result
+	for(i = 0u; i < Size; i++)
+	{
+		pBuffer[i] = ADC->R;
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Start Streaming Acquisition on Hardware Trigger
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler(initialized, FIFO & Hardware Trigger configured)
+ * @param	ADC_FrameTypeDef* RingBuffer
+				Frame Ring Buffer
+ * @param	uint16_t Size
+				Frames in Ring Buffer(Power of 2, 2 ~ 32768)
+ * @param	uint32_t Period
+				Nominal Trigger Period in SysTick Clocks, 0 if lost Triggers are not counted
+ * @return	CSL_StatusTypeDef
+ * @note	Every Trigger(PIT/FTM2/...) converts all FIFO.Channel[] and ADC_IRQn drains
+ *			them into one timestamped Frame. The Channel FIFO is kept by Continuous Mode
+ *			and the Trigger is unmasked by Hardware once the Result FIFO is empty,
+ *			so there is no Software between Frames except the ISR itself.
+ *			Timestamps are taken when the ISR runs, so Jitter includes IRQ latency.
+ *			Enable ADC_IRQn in NVIC before, call CSL_ADC_StreamStop() to stop.
+**/
+CSL_StatusTypeDef CSL_ADC_StreamStart(ADC_HandleTypeDef* cadc, ADC_FrameTypeDef* RingBuffer, uint16_t Size, uint32_t Period)
+{
+	uint8_t i = 0u;
+	
+	//Parameters Check
+	if((cadc == NULL) || (RingBuffer == NULL) || !IS_ADC_RingSize(Size) || \
+	   (cadc->FIFO.state != SET) || (cadc->FIFO.Depth == ADC_FIFO_D0) || (cadc->FIFO.Depth > ADC_FIFO_D8) || \
+	   (cadc->Trigger.state != ADC_TRIG_HARDWARE))
+	{
+		return CSL_Error;
+	}
+	
+	if(cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	//Abort Conversion & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	
+	//Reset Ring & Statistics
+	cadc->Stream.pRing = RingBuffer;
+	cadc->Stream.Mask = Size - 1u;
+	cadc->Stream.Head = 0u;
+	cadc->Stream.Tail = 0u;
+	cadc->Stream.Period = Period;
+	cadc->Stream.LastStamp = 0u;
+	cadc->Stream.MinPeriod = 0xFFFFFFFFu;
+	cadc->Stream.MaxPeriod = 0u;
+	cadc->Stream.Frames = 0u;
+	cadc->Stream.Overflow = 0u;
+	cadc->Stream.Missed = 0u;
+	
+	//Hardware Trigger Source
+	MODIFY_REG(SIM->SOPT0, SIM_SOPT0_ADHWT_MASK, cadc->Trigger.HardTrigger);
+	SET_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	//one Trigger converts the whole Channel FIFO
+	ADC->SC4 = ADC_SC4_HTRGME_MASK | ADC_SC4_AFDEP(cadc->FIFO.Depth);
+	
+	//Trigger is masked until Result FIFO is drained
+	ADC->SC5 = ADC_SC5_HTRGMASKSEL_MASK;
+	
+	cadc->gState = CSL_ADC_STATE_STREAM;
+	
+	//Load Channel FIFO, the last write enables Interrupt & Continuous Mode
+	for(i = 0u; i <= cadc->FIFO.Depth; i++)
+	{
+		if(cadc->FIFO.Channel[i] <= ADC_Channel_15)
+		{
+			ADC->APCTL1 |= 1u << cadc->FIFO.Channel[i];
+		}
+		
+		if(i < cadc->FIFO.Depth)
+		{
+			ADC->SC1 = cadc->FIFO.Channel[i];
+		}
+		else
+		{
+			ADC->SC1 = ADC_SC1_AIEN_MASK | ADC_SC1_ADCO_MASK | cadc->FIFO.Channel[i];
+		}
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop Streaming Acquisition
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @return	CSL_StatusTypeDef
+ * @note	Frames left in Ring can still be read, statistics are kept.
+ *			call CSL_ADC_Init() again to go back to normal Conversion.
+**/
+CSL_StatusTypeDef CSL_ADC_StreamStop(ADC_HandleTypeDef* cadc)
+{
+	if((cadc == NULL) || (cadc->gState != CSL_ADC_STATE_STREAM))
+	{
+		return CSL_Error;
+	}
+	
+	//Abort Conversion, disable Interrupt & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	ADC->SC5 = ADC_SC5_HTRGMASKSEL_MASK;
+	
+	cadc->gState = CSL_ADC_STATE_READY;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Read Frames out of Stream Ring(no-blocking)
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @param	ADC_FrameTypeDef* pFrame
+				Destination Frames
+ * @param	uint16_t Count
+				Max Frames to read
+ * @return	Frames actually read, 0 if Ring is empty
+ * @note	Only one context(Consumer) should read the Ring
+**/
+uint16_t CSL_ADC_StreamRead(ADC_HandleTypeDef* cadc, ADC_FrameTypeDef* pFrame, uint16_t Count)
+{
+	uint16_t tail = cadc->Stream.Tail;
+	uint16_t count = (uint16_t)(cadc->Stream.Head - tail);
+	uint16_t i = 0u;
+	
+	if(cadc->Stream.pRing == NULL)
+	{
+		return 0u;
+	}
+	
+	if(count > Count)
+	{
+		count = Count;
+	}
+	
+	//Head must be read before Frames
+	__DMB();
+	for(i = 0u; i < count; i++)
+	{
+		pFrame[i] = cadc->Stream.pRing[(tail + i) & cadc->Stream.Mask];
+	}
+	cadc->Stream.Tail = tail + count;
+	
+	return count;
+}
+
+/**
+ * @brief	Get Sample-Rate Jitter of Stream
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @return	Longest - Shortest Frame Interval in SysTick Clocks, 0 before two Frames
+ * @note	Intervals with lost Triggers are counted by CSL_ADC_GetStreamDropped() instead
+**/
+uint32_t CSL_ADC_GetStreamJitter(ADC_HandleTypeDef* cadc)
+{
+	uint32_t min = cadc->Stream.MinPeriod;
+	uint32_t max = cadc->Stream.MaxPeriod;
+	
+	return (max >= min) ? (max - min) : 0u;
+}
+
+/**
+ * @brief	Get Frames dropped by Stream
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @return	Frames dropped by full Ring + Triggers lost while FIFO was not drained
+ * @note	lost Triggers are only counted when Period is given to CSL_ADC_StreamStart()
+**/
+uint32_t CSL_ADC_GetStreamDropped(ADC_HandleTypeDef* cadc)
+{
+	return cadc->Stream.Overflow + cadc->Stream.Missed;
+}
+
 /**
  * @brief	ADC Interrupt in CSL
  * @param	ADC_HandleTypeDef* cadc
@@ -133,6 +350,19 @@ uint16_t CSL_ADC_GetSingleValue(ADC_HandleTypeDef* cadc)
 **/
 void CSL_ADC_IRQHandler(ADC_HandleTypeDef* cadc)
 {
+	//Streaming: Result FIFO is drained into Ring
+	if(cadc->gState == CSL_ADC_STATE_STREAM)
+	{
+		if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == SET)
+		{
+			ADC_StreamISR(cadc);
+			
+			//new Frame is in Ring
+			CSL_ADC_StreamFrameCallback(cadc);
+		}
+		return;
+	}
+	
 	if((__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) && __CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_AIEN_MASK)) == SET)
 	{
 		//Disable the ADC Interrupt
@@ -164,6 +394,18 @@ __weak void CSL_ADC_ConvCpltCallback(ADC_HandleTypeDef* cadc)
 	UNUSED(cadc);
 }
 
+/**
+ * @brief	ADC Stream Frame Callback(a Frame is put into Ring)
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler
+ * @return	None
+ * @note	called in ADC ISR, keep it short
+**/
+__weak void CSL_ADC_StreamFrameCallback(ADC_HandleTypeDef* cadc)
+{
+	UNUSED(cadc);
+}
+
 /* Private Functions Definations */
 /**
  * @brief 	ADC Configure
@@ -258,4 +500,89 @@ static void ADC_SetChannel(ADC_HandleTypeDef* cadc)
 	uint32_t tmpreg = ADC->SC1;
 	tmpreg &= ~ADC_SC1_ADCH_MASK;
 	ADC->SC1 = tmpreg | cadc->Init.Channel;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief	Get Timestamp in SysTick Clocks(free running, wraps at 2^32)
+**/
+static uint32_t ADC_GetTimestamp(void)
+{
+	uint32_t load = SysTick->LOAD + 1u;
+	uint32_t tick = 0u, val = 0u;
+	
+	//SysTick ISR may run between the two Reads
+	do
+	{
+		tick = CSL_GetTick();
+		val = SysTick->VAL;
+	}while(tick != CSL_GetTick());
+	
+	//SysTick is reloaded but CSL_IncTick() is still pending behind this ISR
+	if(((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u) && (val > (load >> 1)))
+	{
+		tick++;
+	}
+	
+	//SysTick counts down
+	return tick * load + (load - 1u - val);
+}
+
+/**
+ * @brief	Drain Result FIFO into Stream Ring
+**/
+static void ADC_StreamISR(ADC_HandleTypeDef* cadc)
+{
+	ADC_StreamTypeDef* stream = &cadc->Stream;
+	ADC_FrameTypeDef* frame = NULL;
+	uint32_t stamp = ADC_GetTimestamp();
+	uint32_t delta = stamp - stream->LastStamp;
+	uint16_t head = stream->Head;
+	uint8_t i = 0u;
+	
+	//Frame Interval, Triggers lost while FIFO is not drained are not taken as Jitter
+	if(stream->Frames != 0u)
+	{
+		if((stream->Period != 0u) && (delta > stream->Period + (stream->Period >> 1)))
+		{
+			stream->Missed += (delta + (stream->Period >> 1)) / stream->Period - 1u;
+		}
+		else
+		{
+			if(delta < stream->MinPeriod)
+			{
+				stream->MinPeriod = delta;
+			}
+			if(delta > stream->MaxPeriod)
+			{
+				stream->MaxPeriod = delta;
+			}
+		}
+	}
+	stream->LastStamp = stamp;
+	stream->Frames++;
+	
+	//reading R clears COCO, Trigger is unmasked when FIFO is empty
+	if((uint16_t)(head - stream->Tail) > stream->Mask)
+	{
+		for(i = 0u; i <= cadc->FIFO.Depth; i++)
+		{
+			(void)ADC->R;
+		}
+		stream->Overflow++;
+	}
+	else
+	{
+		frame = &stream->pRing[head & stream->Mask];
+		frame->Timestamp = stamp;
+		for(i = 0u; i <= cadc->FIFO.Depth; i++)
+		{
+			frame->Value[i] = ADC->R;
+		}
+		
+		//Frame must be written before published
+		__DMB();
+		stream->Head = head + 1u;
+	}
+}
+
+//EOF
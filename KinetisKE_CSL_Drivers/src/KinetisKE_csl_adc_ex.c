@@ -7,6 +7,19 @@
 
 #include "KinetisKE_csl_adc_ex.h"
 
+/**
+ * Private Functions
+**/
+static uint16_t ADCEx_Measure(uint8_t Channel);
+static uint16_t ADCEx_SelfTest_Checksum(const ADC_SelfTestTypeDef* ctest);
+static void ADCEx_Oversample_Load(ADC_OversampleTypeDef* cos);
+static void ADCEx_Monitor_Arm(ADC_MonitorTypeDef* cmon);
+static void ADCEx_Sequence_Arm(ADC_SequenceTypeDef* cseq, uint8_t First);
+static void ADCEx_PWMSync_Place(ADC_PWMSyncTypeDef* csync, uint16_t Pulse);
+static void ADCEx_Filter_Boxcar(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride);
+static void ADCEx_Filter_Median(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride);
+static void ADCEx_Filter_Biquad(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride);
+
 /**
  * @brief	Configure ADC as Temperature Sensor
  * @param	uint8_t ref
@@ -62,24 +75,1400 @@ __weak void CSL_ADCEx_MspInit(void)
  * @return 	float
 				Temperature in Celsius
  * @note	Calculation formula is in DataSheet
- *			only for VDDA/VREF = 5.0V
+ *			only for VDDA/VREF = 5.0V, use CSL_ADCEx_ToTemperature() on other References
 **/
 float CSL_ADCEx_GetTemperature(uint16_t Value)
 {
-	float temp = (float)Value * 5.0 / 4096.0;
+	float temp = (float)Value * 5.0f / 4096.0f;
 	
-	//Temperature > 25
-	if(temp > 1.396)
+	//Temperature < 25
+	if(temp > 1.396f)
 	{
-		temp = 25 - (temp - 1.396) / (3.266 * 10e-3);
+		temp = 25.0f - (temp - 1.396f) / 3.266e-3f;
 	}
-	//Temperature <= 25
+	//Temperature >= 25
 	else 
 	{
-		temp = 25 - (temp - 1.396) / (3.638 * 10e-3);
+		temp = 25.0f - (temp - 1.396f) / 3.638e-3f;
 	}
 	
 	return temp;
 }
 
+/**
+ * @brief	Measure Bandgap Reference & calibrate Fixed-Point Conversion(blocking)
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler(initialized, 12 Bits, not Streaming/Oversampling)
+ * @param	ADC_CalibTypeDef* ccal
+				Calibration to be filled
+ * @return 	CSL_StatusTypeDef
+ * @note	16 Conversions of ADC_Channel_BG are averaged by Software Trigger,
+ *			then the previous Channel is written back to SC1.
+ *			FIFO Channels are not restored, call CSL_ADC_Init() again if FIFO is used.
+**/
+CSL_StatusTypeDef CSL_ADCEx_Calibrate(ADC_HandleTypeDef* cadc, ADC_CalibTypeDef* ccal)
+{
+	uint32_t sc1 = 0u, sc2 = 0u, sc4 = 0u, bgbe = 0u, sum = 0u;
+	
+	//Parameter Check
+	if((cadc == NULL) || (ccal == NULL) || (cadc->Init.Length != ADC_DATA_LEN12))
+	{
+		return CSL_Error;
+	}
+	
+	if(cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	sc1 = ADC->SC1 & (ADC_SC1_AIEN_MASK | ADC_SC1_ADCO_MASK | ADC_SC1_ADCH_MASK);
+	sc2 = ADC->SC2;
+	sc4 = ADC->SC4;
+	bgbe = PMC->SPMSC1 & PMC_SPMSC1_BGBE_MASK;
+	
+	//Bandgap Buffer drives ADC Input
+	SET_BIT(PMC->SPMSC1, PMC_SPMSC1_BGBE_MASK);
+	
+	//Abort Conversion, no FIFO, Software Trigger
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	CLEAR_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	//first Conversion lets Bandgap Buffer settle
+	sum = ADCEx_Measure(ADC_Channel_BG);
+	
+	//Restore
+	if(bgbe == 0u)
+	{
+		CLEAR_BIT(PMC->SPMSC1, PMC_SPMSC1_BGBE_MASK);
+	}
+	ADC->SC2 = sc2 & (ADC_SC2_REFSEL_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACFE_MASK | ADC_SC2_ADTRG_MASK);
+	ADC->SC4 = sc4;
+	ADC->SC1 = sc1;
+	
+	return CSL_ADCEx_CalibrateFromCode(ccal, (uint16_t)((sum + 8u) >> 4));
+}
+
+/**
+ * @brief	Calibrate Fixed-Point Conversion from a Bandgap Code
+ * @param	ADC_CalibTypeDef* ccal
+				Calibration to be filled
+ * @param	uint16_t BandgapCode
+				12-bit Code of ADC_Channel_BG(from Stream/FIFO or CSL_ADC_GetSingleValue())
+ * @return 	CSL_StatusTypeDef
+				CSL_Error if the Reference solved is out of ADC_VREF_MIN_MV ~ ADC_VREF_MAX_MV
+ * @note	all Divisions are done here, Conversions only multiply and shift
+**/
+CSL_StatusTypeDef CSL_ADCEx_CalibrateFromCode(ADC_CalibTypeDef* ccal, uint16_t BandgapCode)
+{
+	uint32_t vref = 0u;
+	
+	if((ccal == NULL) || (BandgapCode == 0u))
+	{
+		return CSL_Error;
+	}
+	
+	//VBG = Code * VREF / 4096
+	vref = ((uint32_t)ADC_BANDGAP_MV * 4096u + (BandgapCode >> 1)) / BandgapCode;
+	if((vref < ADC_VREF_MIN_MV) || (vref > ADC_VREF_MAX_MV))
+	{
+		return CSL_Error;
+	}
+	
+	ccal->BandgapCode = BandgapCode;
+	ccal->VREF_mV = (uint16_t)vref;
+	
+	//Code at 25 Celsius in Q4: VTEMP25 * 4096 * 16 / VREF
+	ccal->Temp25Code = (uint16_t)(((uint32_t)ADC_TEMP25_MV * 65536u + (vref >> 1)) / vref);
+	
+	//0.01 Celsius per Q4 Code in Q12: VREF * 100 * 4096 / (4096 * 16 * Slope) = VREF * 6250 / Slope(uV)
+	ccal->TempSlopeCold = (uint16_t)((vref * 6250u + (ADC_TEMP_SLOPE_COLD_UV >> 1)) / ADC_TEMP_SLOPE_COLD_UV);
+	ccal->TempSlopeHot = (uint16_t)((vref * 6250u + (ADC_TEMP_SLOPE_HOT_UV >> 1)) / ADC_TEMP_SLOPE_HOT_UV);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Convert a 12-bit Code to Millivolts
+ * @param	const ADC_CalibTypeDef* ccal
+				Calibration
+ * @param	uint16_t Value
+				12-bit Code
+ * @return 	Voltage in mV
+ * @note	one Multiply & one Shift
+**/
+uint16_t CSL_ADCEx_ToMilliVolt(const ADC_CalibTypeDef* ccal, uint16_t Value)
+{
+	return (uint16_t)(((uint32_t)Value * ccal->VREF_mV + 2048u) >> 12);
+}
+
+/**
+ * @brief	Convert a 12-bit Temperature Sensor Code to Die Temperature
+ * @param	const ADC_CalibTypeDef* ccal
+				Calibration
+ * @param	uint16_t Value
+				12-bit Code of ADC_Channel_T
+ * @return 	Temperature in 0.01 Celsius
+ * @note	Sensor Voltage falls as Temperature rises
+**/
+int16_t CSL_ADCEx_ToTemperature(const ADC_CalibTypeDef* ccal, uint16_t Value)
+{
+	int32_t delta = ((int32_t)Value << 4) - (int32_t)ccal->Temp25Code;
+	
+	//Temperature < 25
+	if(delta > 0)
+	{
+		return (int16_t)(2500 - ((delta * ccal->TempSlopeCold + 2048) >> 12));
+	}
+	//Temperature >= 25
+	else
+	{
+		return (int16_t)(2500 + (((-delta) * ccal->TempSlopeHot + 2048) >> 12));
+	}
+}
+
+/**
+ * @brief	Convert a 12-bit Code to Ratio of Reference
+ * @param	uint16_t Value
+				12-bit Code
+ * @return 	Ratio in Q16(0xFFFF is Full Scale)
+ * @note	for ratiometric Sensors supplied by the Reference itself, no Calibration is needed
+**/
+uint16_t CSL_ADCEx_ToRatio(uint16_t Value)
+{
+	//Value * 65535 / 4095 = Value * 16 + Value / 256
+	return (uint16_t)((Value << 4) + (Value >> 8));
+}
+
+/**
+ * @brief	Convert Vss, RL & RH and solve Offset & Gain Correction(blocking)
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler(initialized, 12 Bits, not Streaming/Oversampling)
+ * @param	ADC_SelfTestTypeDef* ctest
+				Self-Test Result to be filled
+ * @return 	CSL_StatusTypeDef
+				CSL_Error if a Reference is more than ADC_SELFTEST_MAX_ERROR Codes off
+ * @note	each Reference is averaged over 16 Conversions by Software Trigger,
+ *			then the previous Channel is written back to SC1.
+ *			FIFO Channels are not restored, call CSL_ADC_Init() again if FIFO is used.
+**/
+CSL_StatusTypeDef CSL_ADCEx_SelfTest(ADC_HandleTypeDef* cadc, ADC_SelfTestTypeDef* ctest)
+{
+	uint32_t sc1 = 0u, sc2 = 0u, sc4 = 0u, span = 0u;
+	
+	//Parameter Check
+	if((cadc == NULL) || (ctest == NULL) || (cadc->Init.Length != ADC_DATA_LEN12))
+	{
+		return CSL_Error;
+	}
+	
+	if(cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	sc1 = ADC->SC1 & (ADC_SC1_AIEN_MASK | ADC_SC1_ADCO_MASK | ADC_SC1_ADCH_MASK);
+	sc2 = ADC->SC2;
+	sc4 = ADC->SC4;
+	
+	//Abort Conversion, no FIFO, Software Trigger
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	CLEAR_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	ctest->CodeVss = ADCEx_Measure(ADC_Channel_Vss);
+	ctest->CodeRL = ADCEx_Measure(ADC_Channel_RL);
+	ctest->CodeRH = ADCEx_Measure(ADC_Channel_RH);
+	
+	//Restore
+	ADC->SC2 = sc2 & (ADC_SC2_REFSEL_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACFE_MASK | ADC_SC2_ADTRG_MASK);
+	ADC->SC4 = sc4;
+	ADC->SC1 = sc1;
+	
+	ctest->Magic = 0u;
+	
+	//Vss & RL read near 0, RH near Full Scale
+	if((ctest->CodeVss > (ADC_SELFTEST_MAX_ERROR << 4)) || (ctest->CodeRL > (ADC_SELFTEST_MAX_ERROR << 4)) || \
+	   (ctest->CodeRH < ((0xFFFu - ADC_SELFTEST_MAX_ERROR) << 4)))
+	{
+		return CSL_Error;
+	}
+	
+	//Gain = 4095 / (RH - RL) in Q15
+	span = (uint32_t)ctest->CodeRH - ctest->CodeRL;
+	ctest->Offset = (int16_t)ctest->CodeRL;
+	ctest->Gain = (uint16_t)(((0xFFFu << 19) + (span >> 1)) / span);
+	ctest->Magic = ADC_SELFTEST_MAGIC;
+	ctest->Check = ADCEx_SelfTest_Checksum(ctest);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Store Self-Test Result in a Flash Sector
+ * @param	const ADC_SelfTestTypeDef* ctest
+				valid Self-Test Result
+ * @param	uint16_t SectorNum
+				Flash Sector reserved for ADC Coefficients(erased here)
+ * @return 	CSL_StatusTypeDef
+				CSL_Error if Erase/Program reports an Error or any Field reads back different
+ * @note	CSL_Flash_Init() must be called before
+**/
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Save(const ADC_SelfTestTypeDef* ctest, uint16_t SectorNum)
+{
+	ADC_SelfTestTypeDef stored;
+	const uint16_t* src = (const uint16_t*)ctest;
+	const uint16_t* dst = (const uint16_t*)&stored;
+	uint8_t i = 0u;
+	
+	if((ctest == NULL) || (ctest->Magic != ADC_SELFTEST_MAGIC) || (SectorNum >= FLASH_SECTOR_NUMBER))
+	{
+		return CSL_Error;
+	}
+	
+	//Erase Errors are cleared by the next Command, check them before writing
+	CSL_Flash_EraseSector(SectorNum);
+	__FLASH_WAIT_CMD_CPLT();
+	if(FTMRE->FSTAT & (FTMRE_FSTAT_ACCERR_MASK | FTMRE_FSTAT_FPVIOL_MASK | FTMRE_FSTAT_MGSTAT_MASK))
+	{
+		return CSL_Error;
+	}
+	
+	CSL_Flash_WriteSector(SectorNum, (const uint8_t*)ctest, sizeof(ADC_SelfTestTypeDef), 0u);
+	__FLASH_WAIT_CMD_CPLT();
+	if(FTMRE->FSTAT & (FTMRE_FSTAT_ACCERR_MASK | FTMRE_FSTAT_FPVIOL_MASK | FTMRE_FSTAT_MGSTAT_MASK))
+	{
+		return CSL_Error;
+	}
+	
+	//Read back, every Field must equal the Coefficients written
+	if(CSL_ADCEx_SelfTest_Load(&stored, SectorNum) != CSL_OK)
+	{
+		return CSL_Error;
+	}
+	for(i = 0u; i < (sizeof(ADC_SelfTestTypeDef) >> 1); i++)
+	{
+		if(src[i] != dst[i])
+		{
+			return CSL_Error;
+		}
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Load Self-Test Result from a Flash Sector
+ * @param	ADC_SelfTestTypeDef* ctest
+				Self-Test Result to be filled
+ * @param	uint16_t SectorNum
+				Flash Sector of ADC Coefficients
+ * @return 	CSL_StatusTypeDef
+				CSL_Error if the Sector is erased or the Checksum fails
+ * @note	None
+**/
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Load(ADC_SelfTestTypeDef* ctest, uint16_t SectorNum)
+{
+	if((ctest == NULL) || (SectorNum >= FLASH_SECTOR_NUMBER))
+	{
+		return CSL_Error;
+	}
+	
+	*ctest = CSL_Flash_ReadData(SectorNum, 0u, ADC_SelfTestTypeDef);
+	
+	if((ctest->Magic != ADC_SELFTEST_MAGIC) || (ctest->Check != ADCEx_SelfTest_Checksum(ctest)))
+	{
+		ctest->Magic = 0u;
+		return CSL_Error;
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Load ADC Coefficients at Boot, run Self-Test only if none are stored
+ * @param	ADC_HandleTypeDef* cadc
+				ADC Handler(initialized, 12 Bits)
+ * @param	ADC_SelfTestTypeDef* ctest
+				Self-Test Result to be filled
+ * @param	uint16_t SectorNum
+				Flash Sector reserved for ADC Coefficients
+ * @return 	CSL_StatusTypeDef
+ * @note	a Cold Start with stored Coefficients does not convert anything,
+ *			call CSL_ADCEx_SelfTest() & CSL_ADCEx_SelfTest_Save() to force a new Calibration
+**/
+CSL_StatusTypeDef CSL_ADCEx_SelfTest_Init(ADC_HandleTypeDef* cadc, ADC_SelfTestTypeDef* ctest, uint16_t SectorNum)
+{
+	CSL_StatusTypeDef status = CSL_OK;
+	
+	if(CSL_ADCEx_SelfTest_Load(ctest, SectorNum) == CSL_OK)
+	{
+		return CSL_OK;
+	}
+	
+	status = CSL_ADCEx_SelfTest(cadc, ctest);
+	if(status != CSL_OK)
+	{
+		return status;
+	}
+	
+	return CSL_ADCEx_SelfTest_Save(ctest, SectorNum);
+}
+
+/**
+ * @brief	Correct a 12-bit Code by Self-Test Offset & Gain
+ * @param	const ADC_SelfTestTypeDef* ctest
+				valid Self-Test Result
+ * @param	uint16_t Value
+				12-bit Code
+ * @return 	corrected 12-bit Code
+ * @note	one Multiply & one Shift, clipped to 0 ~ 4095.
+ *			No Conversion Path applies it, Caller corrects each Code before
+ *			CSL_ADCEx_ToMilliVolt()/CSL_ADCEx_ToRatio()/Filters.
+**/
+uint16_t CSL_ADCEx_Correct(const ADC_SelfTestTypeDef* ctest, uint16_t Value)
+{
+	int32_t delta = ((int32_t)Value << 4) - ctest->Offset;
+	uint32_t code = 0u;
+	
+	if(delta <= 0)
+	{
+		return 0u;
+	}
+	
+	//Q4 * Q15 --> Q0
+	code = ((uint32_t)delta * ctest->Gain + (1u << 18)) >> 19;
+	
+	return (code > 0xFFFu) ? 0xFFFu : (uint16_t)code;
+}
+
+/**
+ * @brief	Start Oversampling & Decimation on a List of Channels
+ * @param	ADC_OversampleTypeDef* cos
+				Oversampling Handle(cadc, pChannel & Count are filled)
+ * @return 	CSL_StatusTypeDef
+ * @note	Channels are sampled in turn by Software Trigger & Continuous Mode.
+ *			FIFO Scan repeats the Channel in Hardware(1, 4 or 8 Samples per Interrupt),
+ *			the ISR accumulates 4^n Samples and shifts the Sum right by n,
+ *			so a Channel with Bits = 2 gives a 14-bit Result out of 16 Samples.
+ *			call CSL_ADCEx_Oversample_IRQHandler() in ADC_IRQHandler()
+**/
+CSL_StatusTypeDef CSL_ADCEx_Oversample_Start(ADC_OversampleTypeDef* cos)
+{
+	uint8_t i = 0u;
+	
+	//Parameter Check
+	if((cos == NULL) || (cos->cadc == NULL) || (cos->pChannel == NULL) || (cos->Count == 0u) || \
+	   (cos->cadc->Init.Length != ADC_DATA_LEN12))
+	{
+		return CSL_Error;
+	}
+	
+	for(i = 0u; i < cos->Count; i++)
+	{
+		if(!IS_ADC_Channel(cos->pChannel[i].Channel) || (cos->pChannel[i].Bits > ADC_OVERSAMPLE_MAX_BITS))
+		{
+			return CSL_Error;
+		}
+	}
+	
+	if(cos->cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	cos->cadc->gState = CSL_ADC_STATE_OVERSAMPLE;
+	
+	//Abort Conversion, Software Trigger
+	ADC->SC1 = ADC_Channel_None;
+	CLEAR_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	//Disable ADC pin Digital Logic
+	for(i = 0u; i < cos->Count; i++)
+	{
+		if(cos->pChannel[i].Channel <= ADC_Channel_15)
+		{
+			ADC->APCTL1 |= 1u << cos->pChannel[i].Channel;
+		}
+	}
+	
+	cos->Index = 0u;
+	cos->Rounds = 0u;
+	ADCEx_Oversample_Load(cos);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop Oversampling
+ * @param	ADC_OversampleTypeDef* cos
+				Oversampling Handle
+ * @return 	CSL_StatusTypeDef
+ * @note	Results are kept, call CSL_ADC_Init() again to go back to normal Conversion
+**/
+CSL_StatusTypeDef CSL_ADCEx_Oversample_Stop(ADC_OversampleTypeDef* cos)
+{
+	if((cos == NULL) || (cos->cadc == NULL) || (cos->cadc->gState != CSL_ADC_STATE_OVERSAMPLE))
+	{
+		return CSL_Error;
+	}
+	
+	//Abort Conversion, disable Interrupt & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	
+	cos->cadc->gState = CSL_ADC_STATE_READY;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	ADC Oversampling Interrupt(called by ADC_IRQHandler())
+ * @param	ADC_OversampleTypeDef* cos
+				Oversampling Handle
+ * @return 	None
+ * @note	runs once per FIFO Scan, at most 8 Conversions apart
+**/
+void CSL_ADCEx_Oversample_IRQHandler(ADC_OversampleTypeDef* cos)
+{
+	ADC_OversampleChannelTypeDef* ch = NULL;
+	uint32_t acc = cos->Accumulator;
+	uint8_t i = 0u;
+	
+	if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == RESET)
+	{
+		return;
+	}
+	
+	//Drain Result FIFO, reading R clears COCO
+	if(cos->Batch == 1u)
+	{
+		acc += ADC->R;
+	}
+	else
+	{
+		for(i = cos->Batch >> 2; i != 0u; i--)
+		{
+			acc += ADC->R;
+			acc += ADC->R;
+			acc += ADC->R;
+			acc += ADC->R;
+		}
+	}
+	
+	cos->Remain -= cos->Batch;
+	if(cos->Remain != 0u)
+	{
+		cos->Accumulator = acc;
+		return;
+	}
+	
+	//Decimation: 4^n Samples --> 12 + n Bits
+	ch = &cos->pChannel[cos->Index];
+	ch->Result = (uint16_t)(acc >> ch->Bits);
+	
+	//Next Channel
+	cos->Index++;
+	if(cos->Index >= cos->Count)
+	{
+		cos->Index = 0u;
+		cos->Rounds++;
+		
+		//every Channel has a new Result
+		CSL_ADCEx_OversampleCpltCallback(cos);
+	}
+	
+	//Callback may stop Oversampling
+	if(cos->cadc->gState == CSL_ADC_STATE_OVERSAMPLE)
+	{
+		ADCEx_Oversample_Load(cos);
+	}
+}
+
+/**
+ * @brief	Sleep in STOP Mode until a Channel leaves a Window(blocking)
+ * @param	ADC_MonitorTypeDef* cmon
+				Monitor(cadc, Channel, Low, High & Period are filled)
+ * @return 	CSL_StatusTypeDef
+				CSL_OK when woken by a Compare Hit, Value & SleepTime are filled
+ * @note	RTC(LPO / 100) triggers one Conversion every Period, the ADC runs on ADACK
+ *			and the Hardware Compare raises ADC_IRQn only if the Value is out of Window.
+ *			Call CSL_ADCEx_Monitor_ADC_IRQHandler() in ADC0_IRQHandler() and
+ *			CSL_ADCEx_Monitor_RTC_IRQHandler() in RTC_IRQHandler().
+ *			RTC ISR only counts the Period and returns to STOP by SLEEPONEXIT,
+ *			so this function does not return until a Compare Hit.
+ *			Hardware Compare has one Bound: with both Bounds the RTC ISR swaps them,
+ *			each Bound is checked every second Period.
+ *			ADC registers are restored, call CSL_ADC_Init() again if FIFO is used.
+**/
+CSL_StatusTypeDef CSL_ADCEx_Monitor(ADC_MonitorTypeDef* cmon)
+{
+	uint32_t sc2 = 0u, sc3 = 0u, sc4 = 0u, cnt = 0u;
+	
+	//Parameter Check
+	if((cmon == NULL) || (cmon->cadc == NULL) || !IS_ADC_Channel(cmon->Channel) || \
+	   (cmon->Period < ADC_MONITOR_TICK_MS) || (cmon->Period / ADC_MONITOR_TICK_MS > 0x10000u) || \
+	   ((cmon->Low == ADC_MONITOR_LOW_NONE) && (cmon->High == ADC_MONITOR_HIGH_NONE)) || \
+	   ((cmon->High != ADC_MONITOR_HIGH_NONE) && ((cmon->High >= 0x0FFFu) || (cmon->Low > cmon->High))))
+	{
+		return CSL_Error;
+	}
+	
+	if(cmon->cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	cmon->cadc->gState = CSL_ADC_STATE_MONITOR;
+	cmon->Overflows = 0u;
+	cmon->Hit = RESET;
+	cmon->Value = 0u;
+	cmon->SleepTime = 0u;
+	cmon->Side = (cmon->High != ADC_MONITOR_HIGH_NONE) ? ADC_MONITOR_SIDE_HIGH : ADC_MONITOR_SIDE_LOW;
+	
+	sc2 = ADC->SC2;
+	sc3 = ADC->SC3;
+	sc4 = ADC->SC4;
+	
+	//Stop RTC, RTC Overflow triggers ADC
+	__CSL_RTC_CLK_ENABLE();
+	RTC->SC = 0x00u;
+	RTC->MOD = cmon->Period / ADC_MONITOR_TICK_MS - 1u;
+	MODIFY_REG(SIM->SOPT0, SIM_SOPT0_ADHWT_MASK, ADC_HTRIG_RTCOR);
+	
+	//ADACK keeps running in STOP, Low-Power & Long Sample
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	ADC->SC3 = ADC_SC3_ADLPC_MASK | ADC_SC3_ADLSMP_MASK | cmon->cadc->Init.Length | ADC_CLK_ADACK;
+	ADC->SC2 = ADC_SC2_ADTRG_MASK | ADC_SC2_ACFE_MASK | cmon->cadc->Init.Reference;
+	ADCEx_Monitor_Arm(cmon);
+	
+	//Disable ADC pin Digital Logic
+	if(cmon->Channel <= ADC_Channel_15)
+	{
+		ADC->APCTL1 |= 1u << cmon->Channel;
+	}
+	
+	//one Conversion per Trigger, COCO only on Compare Hit
+	ADC->SC1 = ADC_SC1_AIEN_MASK | cmon->Channel;
+	
+	NVIC_EnableIRQ(ADC_IRQn);
+	NVIC_EnableIRQ(RTC_IRQn);
+	
+	//Start RTC: LPO / 100
+	RTC->SC = RTC_SC_RTCLKS(0x01u) | RTC_SC_RTCPS(0x06u) | RTC_SC_RTIE_MASK | RTC_SC_RTIF_MASK;
+	
+	//ISRs return to STOP until Compare Hit clears SLEEPONEXIT
+	SET_BIT(SCB->SCR, SCB_SCR_SLEEPONEXIT_Msk);
+	while(cmon->Hit == RESET)
+	{
+		CSL_PMC_EnterSTOPMode(PMC_LowPower_Entry_WFI);
+	}
+	CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPONEXIT_Msk);
+	
+	//Time in STOP
+	cnt = RTC->CNT;
+	RTC->SC = RTC_SC_RTIF_MASK;
+	cmon->SleepTime = (cmon->Overflows * (RTC->MOD + 1u) + cnt) * ADC_MONITOR_TICK_MS;
+	
+	//Restore ADC
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC2 = sc2 & (ADC_SC2_REFSEL_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACFE_MASK | ADC_SC2_ADTRG_MASK);
+	ADC->SC3 = sc3;
+	ADC->SC4 = sc4;
+	ADC->CV = cmon->cadc->Compare.CompValue;
+	
+	cmon->cadc->gState = CSL_ADC_STATE_READY;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Initialize a Fixed-Point Filter(one per Channel)
+ * @param	ADC_FilterTypeDef* cflt
+				Filter(Type, Length or Coeff are filled)
+ * @return 	CSL_StatusTypeDef
+ * @note	Biquad: y = (b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]) >> 14,
+ *			Coefficients are Q14 so that |a1| up to 2 fits int16_t.
+ *			Filter is primed by its first Sample, there is no Start-up Transient.
+**/
+CSL_StatusTypeDef CSL_ADCEx_Filter_Init(ADC_FilterTypeDef* cflt)
+{
+	if(cflt == NULL)
+	{
+		return CSL_Error;
+	}
+	
+	cflt->Shift = 0u;
+	
+	switch(cflt->Type)
+	{
+		case ADC_FILTER_BOXCAR:
+			//Average by Shift, no Division
+			if((cflt->Length == 0u) || (cflt->Length > ADC_FILTER_WINDOW) || ((cflt->Length & (cflt->Length - 1u)) != 0u))
+			{
+				return CSL_Error;
+			}
+			for(cflt->Shift = 0u; (1u << cflt->Shift) < cflt->Length; cflt->Shift++)
+				;
+			break;
+		case ADC_FILTER_MEDIAN:
+			if((cflt->Length < 3u) || (cflt->Length > ADC_FILTER_WINDOW) || ((cflt->Length & 0x01u) == 0u))
+			{
+				return CSL_Error;
+			}
+			break;
+		case ADC_FILTER_BIQUAD:
+			break;
+		default:
+			return CSL_Error;
+	}
+	
+	cflt->Index = 0u;
+	cflt->Primed = RESET;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Filter ADC Samples in place
+ * @param	ADC_FilterTypeDef* cflt
+				Filter of this Channel
+ * @param	uint16_t* pData
+				first Sample of this Channel
+ * @param	uint16_t Size
+				Samples of this Channel
+ * @param	uint8_t Stride
+				Distance between Samples, Channels in an interleaved FIFO Batch(1 if not interleaved)
+ * @return 	None
+ * @note	Samples are unsigned Codes, Biquad takes up to 14 Bits.
+ *			State is kept in cflt, so Batches can be filtered one by one in ADC Callback.
+**/
+void CSL_ADCEx_Filter_Process(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride)
+{
+	uint8_t i = 0u;
+	
+	if((pData == NULL) || (Size == 0u))
+	{
+		return;
+	}
+	
+	//first Sample fills the Window & State
+	if(cflt->Primed == RESET)
+	{
+		for(i = 0u; i < ADC_FILTER_WINDOW; i++)
+		{
+			cflt->Window[i] = *pData;
+			cflt->Sorted[i] = *pData;
+		}
+		cflt->Sum = (uint32_t)*pData << cflt->Shift;
+		cflt->State[0] = *pData;
+		cflt->State[1] = *pData;
+		cflt->State[2] = *pData;
+		cflt->State[3] = *pData;
+		cflt->State[4] = 0;
+		cflt->Primed = SET;
+	}
+	
+	switch(cflt->Type)
+	{
+		case ADC_FILTER_BOXCAR:
+			ADCEx_Filter_Boxcar(cflt, pData, Size, Stride);
+			break;
+		case ADC_FILTER_MEDIAN:
+			ADCEx_Filter_Median(cflt, pData, Size, Stride);
+			break;
+		case ADC_FILTER_BIQUAD:
+			ADCEx_Filter_Biquad(cflt, pData, Size, Stride);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief	Start a Channel Sequence longer than the FIFO
+ * @param	ADC_SequenceTypeDef* cseq
+				Sequencer(cadc, pEntry, Count, pResult & Continuous are filled)
+ * @return 	CSL_StatusTypeDef
+ * @note	Entries are packed in order into Segments of up to 8 Conversions,
+ *			an Entry is never split. The ISR drains each Segment and loads the next one
+ *			before summing, CSL_ADCEx_SequenceCpltCallback() is called once per Sequence.
+ *			Software Trigger, call CSL_ADCEx_Sequence_IRQHandler() in ADC0_IRQHandler()
+**/
+CSL_StatusTypeDef CSL_ADCEx_Sequence_Start(ADC_SequenceTypeDef* cseq)
+{
+	uint8_t i = 0u;
+	
+	//Parameter Check
+	if((cseq == NULL) || (cseq->cadc == NULL) || (cseq->pEntry == NULL) || (cseq->pResult == NULL) || (cseq->Count == 0u))
+	{
+		return CSL_Error;
+	}
+	
+	for(i = 0u; i < cseq->Count; i++)
+	{
+		if(!IS_ADC_Channel(cseq->pEntry[i].Channel) || (cseq->pEntry[i].Samples == 0u) || \
+		   (cseq->pEntry[i].Samples > ADC_SEQUENCE_SEGMENT))
+		{
+			return CSL_Error;
+		}
+	}
+	
+	if(cseq->cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	cseq->cadc->gState = CSL_ADC_STATE_SEQUENCE;
+	cseq->Sequences = 0u;
+	
+	//Abort Conversion, Software Trigger
+	ADC->SC1 = ADC_Channel_None;
+	CLEAR_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	//Disable ADC pin Digital Logic
+	for(i = 0u; i < cseq->Count; i++)
+	{
+		if(cseq->pEntry[i].Channel <= ADC_Channel_15)
+		{
+			ADC->APCTL1 |= 1u << cseq->pEntry[i].Channel;
+		}
+	}
+	
+	ADCEx_Sequence_Arm(cseq, 0u);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop Channel Sequence
+ * @param	ADC_SequenceTypeDef* cseq
+				Sequencer
+ * @return 	CSL_StatusTypeDef
+ * @note	call CSL_ADC_Init() again to go back to normal Conversion
+**/
+CSL_StatusTypeDef CSL_ADCEx_Sequence_Stop(ADC_SequenceTypeDef* cseq)
+{
+	if((cseq == NULL) || (cseq->cadc == NULL) || (cseq->cadc->gState != CSL_ADC_STATE_SEQUENCE))
+	{
+		return CSL_Error;
+	}
+	
+	//Abort Conversion, disable Interrupt & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	
+	cseq->cadc->gState = CSL_ADC_STATE_READY;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	ADC Channel Sequencer Interrupt(called by ADC0_IRQHandler())
+ * @param	ADC_SequenceTypeDef* cseq
+				Sequencer
+ * @return 	None
+ * @note	one Interrupt per Segment
+**/
+void CSL_ADCEx_Sequence_IRQHandler(ADC_SequenceTypeDef* cseq)
+{
+	const ADC_SequenceEntryTypeDef* entry = cseq->pEntry;
+	uint16_t raw[ADC_SEQUENCE_SEGMENT];
+	uint8_t first = cseq->First, n = cseq->Conversions, i = 0u, k = 0u;
+	uint16_t sum = 0u;
+	Flag_Status last = (cseq->Next >= cseq->Count) ? SET : RESET;
+	
+	if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == RESET)
+	{
+		return;
+	}
+	
+	//Drain Result FIFO
+	for(i = 0u; i < n; i++)
+	{
+		raw[i] = ADC->R;
+	}
+	
+	//Load next Segment before anything else
+	if(last == RESET)
+	{
+		ADCEx_Sequence_Arm(cseq, cseq->Next);
+	}
+	else if(cseq->Continuous == SET)
+	{
+		ADCEx_Sequence_Arm(cseq, 0u);
+	}
+	else
+	{
+		ADC->SC4 = 0x00u;
+		cseq->cadc->gState = CSL_ADC_STATE_READY;
+	}
+	
+	//Sum Samples of each Entry
+	for(k = 0u; k < n; first++)
+	{
+		sum = 0u;
+		for(i = entry[first].Samples; i != 0u; i--)
+		{
+			sum += raw[k++];
+		}
+		cseq->pResult[first] = sum;
+	}
+	
+	if(last == SET)
+	{
+		cseq->Sequences++;
+		
+		//every Entry has a new Result
+		CSL_ADCEx_SequenceCpltCallback(cseq);
+	}
+}
+
+/**
+ * @brief	ADC Channel Sequence Complete Callback
+ * @param	ADC_SequenceTypeDef* cseq
+				Sequencer
+ * @return 	None
+ * @note	called in ADC ISR, pResult is overwritten from next Segment on in Continuous Mode
+**/
+__weak void CSL_ADCEx_SequenceCpltCallback(ADC_SequenceTypeDef* cseq)
+{
+	UNUSED(cseq);
+}
+
+/**
+ * @brief	Start ADC Sampling triggered by FTM2 PWM
+ * @param	ADC_PWMSyncTypeDef* csync
+				PWM Sync(cadc, cftm, PWMChannel, TrigChannel, Position & Delay are filled)
+ * @return 	CSL_StatusTypeDef
+ * @note	TrigChannel matches at TrigPoint inside the Low-Side On-Time of PWMChannel
+ *			and its Match triggers one Conversion of all FIFO Channels, once per PWM Cycle.
+ *			Change the Duty by CSL_ADCEx_PWMSync_SetDuty() so the Trigger follows it.
+ *			Center-aligned PWM matches on up & down Count, only Position 0x8000(Counter
+ *			Peak) gives one Trigger per Cycle there.
+ *			call CSL_ADCEx_PWMSync_IRQHandler() in ADC0_IRQHandler()
+**/
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_Start(ADC_PWMSyncTypeDef* csync)
+{
+	static const uint8_t trig[6] = {FTM_EXTTRIG_CH0TRIG_MASK, FTM_EXTTRIG_CH1TRIG_MASK, FTM_EXTTRIG_CH2TRIG_MASK,
+									FTM_EXTTRIG_CH3TRIG_MASK, FTM_EXTTRIG_CH4TRIG_MASK, FTM_EXTTRIG_CH5TRIG_MASK};
+	FTM_Type* ftm = NULL;
+	ADC_HandleTypeDef* cadc = NULL;
+	uint8_t i = 0u;
+	
+	//Parameter Check
+	if((csync == NULL) || (csync->cadc == NULL) || (csync->cftm == NULL) || (csync->cftm->Instance != FTM2) || \
+	   !IS_FTM_CHANNEL(csync->PWMChannel) || !IS_FTM_CHANNEL(csync->TrigChannel) || \
+	   (csync->PWMChannel == csync->TrigChannel) || (csync->cadc->FIFO.Depth > ADC_FIFO_D8))
+	{
+		return CSL_Error;
+	}
+	
+	cadc = csync->cadc;
+	ftm = csync->cftm->Instance;
+	
+	if(cadc->gState != CSL_ADC_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	
+	cadc->gState = CSL_ADC_STATE_PWMSYNC;
+	csync->Ready = 0u;
+	csync->Cycles = 0u;
+	csync->Latency = 0u;
+	csync->MaxLatency = 0u;
+	
+	//Trigger Channel: Software Compare, Match only drives the External Trigger
+	__CSL_FTM_WP_DISABLE(ftm);
+	ftm->CONTROLS[csync->TrigChannel].CnSC = FTM_CnSC_MSA_MASK;
+	ADCEx_PWMSync_Place(csync, (uint16_t)ftm->CONTROLS[csync->PWMChannel].CnV);
+	SET_BIT(ftm->EXTTRIG, trig[csync->TrigChannel]);
+	__CSL_FTM_WP_ENABLE(ftm);
+	
+	//Abort Conversion & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	
+	//FTM2 Match with Delay triggers ADC
+	MODIFY_REG(SIM->SOPT0, SIM_SOPT0_ADHWT_MASK | SIM_SOPT0_DELAY_MASK, ADC_HTRIG_FTM2MATCH | SIM_SOPT0_DELAY(csync->Delay));
+	SET_BIT(ADC->SC2, ADC_SC2_ADTRG_MASK);
+	
+	//one Trigger converts the whole Channel FIFO, Trigger is masked until Result FIFO is drained
+	ADC->SC4 = ADC_SC4_HTRGME_MASK | ADC_SC4_AFDEP(cadc->FIFO.Depth);
+	ADC->SC5 = ADC_SC5_HTRGMASKSEL_MASK;
+	
+	//Load Channel FIFO, Continuous Mode keeps it for every Trigger(single Channel: one Conversion per Trigger)
+	for(i = 0u; i <= cadc->FIFO.Depth; i++)
+	{
+		if(cadc->FIFO.Channel[i] <= ADC_Channel_15)
+		{
+			ADC->APCTL1 |= 1u << cadc->FIFO.Channel[i];
+		}
+		
+		if(i < cadc->FIFO.Depth)
+		{
+			ADC->SC1 = cadc->FIFO.Channel[i];
+		}
+		else if(cadc->FIFO.Depth != ADC_FIFO_D0)
+		{
+			ADC->SC1 = ADC_SC1_AIEN_MASK | ADC_SC1_ADCO_MASK | cadc->FIFO.Channel[i];
+		}
+		else
+		{
+			ADC->SC1 = ADC_SC1_AIEN_MASK | cadc->FIFO.Channel[i];
+		}
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop ADC Sampling triggered by FTM2 PWM
+ * @param	ADC_PWMSyncTypeDef* csync
+				PWM Sync
+ * @return 	CSL_StatusTypeDef
+ * @note	PWM keeps running, call CSL_ADC_Init() again to go back to normal Conversion
+**/
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_Stop(ADC_PWMSyncTypeDef* csync)
+{
+	FTM_Type* ftm = NULL;
+	
+	if((csync == NULL) || (csync->cadc == NULL) || (csync->cadc->gState != CSL_ADC_STATE_PWMSYNC))
+	{
+		return CSL_Error;
+	}
+	
+	//Abort Conversion, disable Interrupt & reset FIFO
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = 0x00u;
+	
+	//no more Channel Triggers
+	ftm = csync->cftm->Instance;
+	CLEAR_BIT(ftm->EXTTRIG, FTM_EXTTRIG_CH0TRIG_MASK | FTM_EXTTRIG_CH1TRIG_MASK | FTM_EXTTRIG_CH2TRIG_MASK | \
+							FTM_EXTTRIG_CH3TRIG_MASK | FTM_EXTTRIG_CH4TRIG_MASK | FTM_EXTTRIG_CH5TRIG_MASK);
+	
+	csync->cadc->gState = CSL_ADC_STATE_READY;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Change PWM Duty and move ADC Trigger with it
+ * @param	ADC_PWMSyncTypeDef* csync
+				PWM Sync
+ * @param	uint16_t Pulse
+				CnV of PWMChannel(High-Side On-Time in FTM2 Counts)
+ * @return 	CSL_StatusTypeDef
+ * @note	PWM CnV is loaded by FTM at end of Cycle, Trigger CnV at once,
+ *			so the Cycle being updated may be sampled at the new Point.
+ *			if both Channels are in the Group of CSL_FTM_PWM_SyncInit(), they are
+ *			loaded together at the next Period Boundary.
+**/
+CSL_StatusTypeDef CSL_ADCEx_PWMSync_SetDuty(ADC_PWMSyncTypeDef* csync, uint16_t Pulse)
+{
+	if((csync == NULL) || (csync->cftm == NULL))
+	{
+		return CSL_Error;
+	}
+	
+	csync->cftm->Instance->CONTROLS[csync->PWMChannel].CnV = Pulse;
+	ADCEx_PWMSync_Place(csync, Pulse);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	ADC PWM Synchronized Sampling Interrupt(called by ADC0_IRQHandler())
+ * @param	ADC_PWMSyncTypeDef* csync
+				PWM Sync
+ * @return 	None
+ * @note	one Interrupt per PWM Cycle
+**/
+void CSL_ADCEx_PWMSync_IRQHandler(ADC_PWMSyncTypeDef* csync)
+{
+	FTM_Type* ftm = csync->cftm->Instance;
+	uint16_t cnt = (uint16_t)ftm->CNT, mod = (uint16_t)ftm->MOD, point = csync->TrigPoint;
+	uint16_t latency = 0u;
+	uint8_t fill = csync->Ready ^ 0x01u, i = 0u;
+	
+	if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == RESET)
+	{
+		return;
+	}
+	
+	//Trigger-to-Result in FTM2 Counts
+	if((ftm->SC & FTM_SC_CPWMS_MASK) != 0u)
+	{
+		//Counter goes down after the Peak
+		latency = (cnt > point) ? (cnt - point) : (point - cnt);
+	}
+	else
+	{
+		latency = (cnt >= point) ? (cnt - point) : (uint16_t)(cnt + mod + 1u - point);
+	}
+	
+	//Drain Result FIFO, Trigger is unmasked when it is empty
+	for(i = 0u; i <= csync->cadc->FIFO.Depth; i++)
+	{
+		csync->Buffer[fill][i] = ADC->R;
+	}
+	
+	csync->Latency = latency;
+	if(latency > csync->MaxLatency)
+	{
+		csync->MaxLatency = latency;
+	}
+	csync->Ready = fill;
+	csync->Cycles++;
+	
+	//Results of this Cycle
+	CSL_ADCEx_PWMSyncCpltCallback(csync, csync->Buffer[fill]);
+}
+
+/**
+ * @brief	ADC PWM Synchronized Sampling Callback(Results of one PWM Cycle)
+ * @param	ADC_PWMSyncTypeDef* csync
+				PWM Sync
+ * @param	const uint16_t* pResult
+				Results in Order of FIFO.Channel[], valid until next Cycle completes
+ * @return 	None
+ * @note	called in ADC ISR
+**/
+__weak void CSL_ADCEx_PWMSyncCpltCallback(ADC_PWMSyncTypeDef* csync, const uint16_t* pResult)
+{
+	UNUSED(csync);
+	UNUSED(pResult);
+}
+
+/**
+ * @brief	ADC Window Monitor ADC Interrupt(called by ADC0_IRQHandler())
+ * @param	ADC_MonitorTypeDef* cmon
+				Monitor
+ * @return 	None
+ * @note	COCO is SET only by a Compare Hit
+**/
+void CSL_ADCEx_Monitor_ADC_IRQHandler(ADC_MonitorTypeDef* cmon)
+{
+	if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == SET)
+	{
+		cmon->Value = ADC->R;
+		
+		//no more Conversions
+		ADC->SC1 = ADC_Channel_None;
+		cmon->Hit = SET;
+		
+		//return to Thread
+		CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPONEXIT_Msk);
+	}
+}
+
+/**
+ * @brief	ADC Window Monitor RTC Interrupt(called by RTC_IRQHandler())
+ * @param	ADC_MonitorTypeDef* cmon
+				Monitor
+ * @return 	None
+ * @note	runs once per Period, the Core goes back to STOP after it
+**/
+void CSL_ADCEx_Monitor_RTC_IRQHandler(ADC_MonitorTypeDef* cmon)
+{
+	//Clear RTC Flag
+	RTC->SC |= RTC_SC_RTIF_MASK;
+	cmon->Overflows++;
+	
+	//both Bounds: swap after the Conversion of this Trigger
+	if((cmon->Low != ADC_MONITOR_LOW_NONE) && (cmon->High != ADC_MONITOR_HIGH_NONE) && (cmon->Hit == RESET))
+	{
+		while(__CSL_ADC_GET_STATE(ADC->SC2, ADC_SC2_ADACT_MASK) == SET)
+			;
+		
+		//Hit is pending in ADC ISR
+		if(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == SET)
+		{
+			return;
+		}
+		
+		cmon->Side ^= 0x01u;
+		ADCEx_Monitor_Arm(cmon);
+	}
+}
+
+/**
+ * @brief	ADC Oversampling Complete Callback(all Channels are updated)
+ * @param	ADC_OversampleTypeDef* cos
+				Oversampling Handle
+ * @return 	None
+ * @note	called in ADC ISR
+**/
+__weak void CSL_ADCEx_OversampleCpltCallback(ADC_OversampleTypeDef* cos)
+{
+	UNUSED(cos);
+}
+
+/**
+ * @brief	Sum of 16 Conversions(Q4 Code) after one discarded, Software Trigger
+**/
+static uint16_t ADCEx_Measure(uint8_t Channel)
+{
+	uint32_t sum = 0u;
+	uint8_t i = 0u;
+	
+	for(i = 0u; i <= 0x10u; i++)
+	{
+		ADC->SC1 = Channel;
+		while(__CSL_ADC_GET_STATE(ADC->SC1, ADC_SC1_COCO_MASK) == RESET)
+			;
+		
+		if(i != 0u)
+		{
+			sum += ADC->R;
+		}
+		else
+		{
+			(void)ADC->R;
+		}
+	}
+	
+	return (uint16_t)sum;
+}
+
+/**
+ * @brief	Checksum of Self-Test Result(16-bit Sum of Halfwords before Check, the last Field, inverted)
+**/
+static uint16_t ADCEx_SelfTest_Checksum(const ADC_SelfTestTypeDef* ctest)
+{
+	const uint16_t* p = (const uint16_t*)ctest;
+	uint16_t sum = 0u;
+	uint8_t i = 0u;
+	
+	for(i = 0u; i < ((sizeof(ADC_SelfTestTypeDef) >> 1) - 1u); i++)
+	{
+		sum += p[i];
+	}
+	
+	return (uint16_t)~sum;
+}
+
+/**
+ * @brief	Start FIFO Scan on current Oversampling Channel
+**/
+static void ADCEx_Oversample_Load(ADC_OversampleTypeDef* cos)
+{
+	ADC_OversampleChannelTypeDef* ch = &cos->pChannel[cos->Index];
+	
+	//4^n Samples, FIFO Scan of 1, 4 or 8
+	cos->Remain = 1u << (ch->Bits << 1);
+	cos->Batch = (ch->Bits == 0u) ? 1u : ((ch->Bits == 1u) ? 4u : 8u);
+	cos->Accumulator = 0u;
+	
+	//Abort & reset FIFO before changing Depth
+	ADC->SC1 = ADC_Channel_None;
+	ADC->SC4 = ADC_SC4_ASCANE_MASK | ADC_SC4_AFDEP(cos->Batch - 1u);
+	
+	//Scan Mode repeats this Channel until Result FIFO is full
+	ADC->SC1 = ADC_SC1_AIEN_MASK | ADC_SC1_ADCO_MASK | ch->Channel;
+}
+
+/**
+ * @brief	Arm Hardware Compare on current Monitor Bound
+**/
+static void ADCEx_Monitor_Arm(ADC_MonitorTypeDef* cmon)
+{
+	if(cmon->Side == ADC_MONITOR_SIDE_HIGH)
+	{
+		//Value >= High + 1
+		ADC->CV = cmon->High + 1u;
+		SET_BIT(ADC->SC2, ADC_SC2_ACFGT_MASK);
+	}
+	else
+	{
+		//Value < Low
+		ADC->CV = cmon->Low;
+		CLEAR_BIT(ADC->SC2, ADC_SC2_ACFGT_MASK);
+	}
+}
+
+/**
+ * @brief	Load the Segment starting at an Entry into Channel FIFO
+**/
+static void ADCEx_Sequence_Arm(ADC_SequenceTypeDef* cseq, uint8_t First)
+{
+	const ADC_SequenceEntryTypeDef* entry = cseq->pEntry;
+	uint8_t next = First, n = 0u, i = 0u;
+	
+	//whole Entries fitting in FIFO
+	while((next < cseq->Count) && (n + entry[next].Samples <= ADC_SEQUENCE_SEGMENT))
+	{
+		n += entry[next].Samples;
+		next++;
+	}
+	cseq->First = First;
+	cseq->Next = next;
+	cseq->Conversions = n;
+	
+	ADC->SC4 = ADC_SC4_AFDEP(n - 1u);
+	
+	//Conversion starts when Channel FIFO is filled
+	for(; First < next; First++)
+	{
+		for(i = entry[First].Samples; i != 0u; i--)
+		{
+			ADC->SC1 = ADC_SC1_AIEN_MASK | entry[First].Channel;
+		}
+	}
+}
+
+/**
+ * @brief	Place Trigger Channel inside Low-Side On-Time of a Duty
+**/
+static void ADCEx_PWMSync_Place(ADC_PWMSyncTypeDef* csync, uint16_t Pulse)
+{
+	FTM_Type* ftm = csync->cftm->Instance;
+	uint32_t mod = ftm->MOD, point = 0u;
+	
+	if(Pulse > mod)
+	{
+		Pulse = (uint16_t)mod;
+	}
+	
+	if((ftm->SC & FTM_SC_CPWMS_MASK) != 0u)
+	{
+		//Low-Side is on from CnV up to MOD and back, its middle is the Peak
+		point = Pulse + (((mod - Pulse) * csync->Position) >> 15);
+	}
+	else
+	{
+		//Low-Side is on from CnV to MOD
+		point = Pulse + (((mod + 1u - Pulse) * csync->Position) >> 16);
+	}
+	
+	if(point > mod)
+	{
+		point = mod;
+	}
+	
+	csync->TrigPoint = (uint16_t)point;
+	ftm->CONTROLS[csync->TrigChannel].CnV = point;
+	
+	//Channels under CSL_FTM_PWM_SyncInit() load Duty & Trigger together on Software Trigger
+	if(ftm->MODE & FTM_MODE_FTMEN_MASK)
+	{
+		SET_BIT(ftm->SYNC, FTM_SYNC_SWSYNC_MASK);
+	}
+}
+
+/**
+ * @brief	Boxcar: Running Sum of Window, Average by Shift
+**/
+static void ADCEx_Filter_Boxcar(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride)
+{
+	uint32_t sum = cflt->Sum, round = (1u << cflt->Shift) >> 1;
+	uint8_t index = cflt->Index, mask = cflt->Length - 1u;
+	uint16_t x = 0u;
+	
+	for(; Size != 0u; Size--)
+	{
+		x = *pData;
+		sum += x - cflt->Window[index];
+		cflt->Window[index] = x;
+		index = (index + 1u) & mask;
+		
+		*pData = (uint16_t)((sum + round) >> cflt->Shift);
+		pData += Stride;
+	}
+	
+	cflt->Sum = sum;
+	cflt->Index = index;
+}
+
+/**
+ * @brief	Median: Sorted Window, oldest Sample is replaced by Insertion
+**/
+static void ADCEx_Filter_Median(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride)
+{
+	uint16_t* sorted = cflt->Sorted;
+	uint8_t index = cflt->Index, len = cflt->Length, i = 0u;
+	uint16_t x = 0u, old = 0u;
+	
+	for(; Size != 0u; Size--)
+	{
+		x = *pData;
+		old = cflt->Window[index];
+		cflt->Window[index] = x;
+		index = (index + 1u == len) ? 0u : (index + 1u);
+		
+		//Slot of oldest Sample
+		for(i = 0u; sorted[i] != old; i++)
+			;
+		
+		//move the Slot to where new Sample belongs
+		if(x > old)
+		{
+			for(; (i + 1u < len) && (sorted[i + 1u] < x); i++)
+			{
+				sorted[i] = sorted[i + 1u];
+			}
+		}
+		else
+		{
+			for(; (i > 0u) && (sorted[i - 1u] > x); i--)
+			{
+				sorted[i] = sorted[i - 1u];
+			}
+		}
+		sorted[i] = x;
+		
+		*pData = sorted[len >> 1];
+		pData += Stride;
+	}
+	
+	cflt->Index = index;
+}
+
+/**
+ * @brief	Biquad: Direct Form I, Q14 Coefficients, Fraction of y is fed back
+**/
+static void ADCEx_Filter_Biquad(ADC_FilterTypeDef* cflt, uint16_t* pData, uint16_t Size, uint8_t Stride)
+{
+	int32_t b0 = cflt->Coeff[0], b1 = cflt->Coeff[1], b2 = cflt->Coeff[2];
+	int32_t a1 = cflt->Coeff[3], a2 = cflt->Coeff[4];
+	int32_t x1 = cflt->State[0], x2 = cflt->State[1];
+	int32_t y1 = cflt->State[2], y2 = cflt->State[3];
+	int32_t frac = cflt->State[4];
+	int32_t x = 0, acc = 0;
+	
+	for(; Size != 0u; Size--)
+	{
+		x = *pData;
+		
+		//5 single-cycle Multiplies on M0+
+		acc = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2 + frac;
+		x2 = x1;
+		x1 = x;
+		y2 = y1;
+		y1 = acc >> 14;
+		
+		//Truncation Error goes into next Sample, no DC Error
+		frac = acc - (y1 << 14);
+		
+		//Saturate Output & State
+		if(y1 < 0)
+		{
+			y1 = 0;
+		}
+		else if(y1 > 0xFFFF)
+		{
+			y1 = 0xFFFF;
+		}
+		
+		*pData = (uint16_t)y1;
+		pData += Stride;
+	}
+	
+	cflt->State[0] = x1;
+	cflt->State[1] = x2;
+	cflt->State[2] = y1;
+	cflt->State[3] = y2;
+	cflt->State[4] = frac;
+}
+
 //EOF
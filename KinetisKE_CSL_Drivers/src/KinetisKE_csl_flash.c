@@ -49,6 +49,10 @@ void CSL_Flash_EraseSector(uint16_t SectorNum)
 	//Get address
 	uint32_t addr = (uint32_t)SectorNum * FLASH_SECTOR_SIZE;
 
+	//previous command must be completed before FCCOB is written
+	__FLASH_WAIT_CMD_CPLT();
+	__FLASH_CLEAR_ERROR_FLAG();
+
 	//Write command & address
     FTMRE->FCCOBIX = 0;
     FTMRE->FCCOBHI = FC_Erase_Sector;
@@ -71,20 +75,25 @@ void CSL_Flash_EraseSector(uint16_t SectorNum)
  * @param	uint32_t size
 				Data size
  * @param	uint32_t offset
-				Address offset
+				Address offset in Sector(Longword aligned)
  * @return	None
- * @note	None
+ * @note	waits for CCIF before every Longword, the last one may still be
+ *			programming on return(see __FLASH_WAIT_CMD_CPLT())
 **/
 void CSL_Flash_WriteSector(uint16_t SectorNum, const uint8_t* pBuffer, uint32_t size, uint32_t offset)
 {
 	assert_param(IS_FLASH_SECTOR_NUM(SectorNum));
 	
 	//Get address
-	uint32_t addr = (uint32_t)SectorNum * FLASH_SECTOR_SIZE;
+	uint32_t addr = (uint32_t)SectorNum * FLASH_SECTOR_SIZE + offset;
 	uint16_t step = 4;
 	
 	for(uint16_t i = 0; i < size; i += step)
 	{
+		//previous command(Erase or last Longword) must be completed before FCCOB is written
+		__FLASH_WAIT_CMD_CPLT();
+		__FLASH_CLEAR_ERROR_FLAG();
+		
         FTMRE->FCCOBIX = 0;
         FTMRE->FCCOBHI = FC_Program_Flash;
         FTMRE->FCCOBLO = addr >> 16;
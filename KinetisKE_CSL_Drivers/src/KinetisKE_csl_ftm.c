@@ -8,10 +8,11 @@
 #include "KinetisKE_csl_ftm.h"
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	FTM Basic Initialization
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	Counter is not clocked until CSL_FTM_Base_Start()
 **/
 CSL_StatusTypeDef CSL_FTM_Base_Init(FTM_HandleTypeDef* cftm)
 {
@@ -21,6 +22,9 @@ CSL_StatusTypeDef CSL_FTM_Base_Init(FTM_HandleTypeDef* cftm)
 		return CSL_Error;
 	}
 	
+	//Msp Init
+	CSL_FTM_Base_MspInit(cftm);
+	
 	//Disable Write Protection
 	if(cftm->Instance == FTM2)
 	{
@@ -37,17 +41,50 @@ CSL_StatusTypeDef CSL_FTM_Base_Init(FTM_HandleTypeDef* cftm)
 		__CSL_FTM_WP_ENABLE(cftm->Instance);
 	}
 	
+	cftm->gState = CSL_FTM_STATE_READY;
+	
 	return CSL_OK;
 }
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	FTM Basic DeInitialization
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	None
 **/
 CSL_StatusTypeDef CSL_FTM_Base_DeInit(FTM_HandleTypeDef* cftm)
-{}
+{
+	//Parameter Check
+	if(cftm == NULL)
+	{
+		return CSL_Error;
+	}
+	
+	//Disable Write Protection
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_DISABLE(cftm->Instance);
+	}
+	
+	//Stop Counter & reset Registers
+	cftm->Instance->SC = (uint32_t)0x00u;
+	cftm->Instance->CNT = (uint32_t)0x00u;
+	cftm->Instance->MOD = (uint32_t)0x00u;
+	
+	//Enable Write Protection
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_ENABLE(cftm->Instance);
+	}
+	
+	//Msp DeInit
+	CSL_FTM_Base_MspDeInit(cftm);
+	
+	cftm->gState = CSL_FTM_STATE_RESET;
+	
+	return CSL_OK;
+}
 
 /**
  * @brief
@@ -72,10 +109,11 @@ __weak void CSL_FTM_Base_MspDeInit(FTM_HandleTypeDef* cftm)
 }
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	Start FTM Counter
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	Clock Source & PreScaler are written to SC here
 **/
 CSL_StatusTypeDef CSL_FTM_Base_Start(FTM_HandleTypeDef* cftm)
 {
@@ -86,31 +124,220 @@ CSL_StatusTypeDef CSL_FTM_Base_Start(FTM_HandleTypeDef* cftm)
 	
 	assert_param(IS_FTM_CLKSource(cftm->Init.ClockSource));
 	assert_param(IS_FTM_PreScaler(cftm->Init.PreScaler));
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_DISABLE(cftm->Instance);
+	}
+	
+	MODIFY_REG(cftm->Instance->SC, FTM_SC_CLKS_MASK | FTM_SC_PS_MASK, cftm->Init.ClockSource | cftm->Init.PreScaler);
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_ENABLE(cftm->Instance);
+	}
+	
+	cftm->gState = CSL_FTM_STATE_BUSY;
+	
+	return CSL_OK;
 }
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	Stop FTM Counter
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	Counter keeps its Value
 **/
 CSL_StatusTypeDef CSL_FTM_Base_Stop(FTM_HandleTypeDef* cftm)
-{}
+{
+	if(cftm == NULL)
+	{
+		return CSL_Error;
+	}
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_DISABLE(cftm->Instance);
+	}
+	
+	CLEAR_BIT(cftm->Instance->SC, FTM_SC_CLKS_MASK);
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_ENABLE(cftm->Instance);
+	}
+	
+	cftm->gState = CSL_FTM_STATE_READY;
+	
+	return CSL_OK;
+}
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	Start FTM Counter with OverFlow Interrupt
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	None
 **/
 CSL_StatusTypeDef CSL_FTM_Base_Start_IT(FTM_HandleTypeDef* cftm)
-{}
+{
+	if(cftm == NULL)
+	{
+		return CSL_Error;
+	}
+	
+	//Clear pending OverFlow, then enable its Interrupt
+	__CSL_FTM_TOIE_CLEAR_FLAG(cftm);
+	__CSL_FTM_TOIE_ENABLE(cftm);
+	
+	return CSL_FTM_Base_Start(cftm);
+}
 
 /**
- * @brief
- * @param
- * @return
- * @note
+ * @brief	Stop FTM Counter & OverFlow Interrupt
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @return	CSL_StatusTypeDef
+ * @note	None
 **/
 CSL_StatusTypeDef CSL_FTM_Base_Stop_IT(FTM_HandleTypeDef* cftm)
-{}
\ No newline at end of file
+{
+	if(cftm == NULL)
+	{
+		return CSL_Error;
+	}
+	
+	__CSL_FTM_TOIE_DISABLE(cftm);
+	
+	return CSL_FTM_Base_Stop(cftm);
+}
+
+/**
+ * @brief	Configure one PWM Channel
+ * @param	FTM_HandleTypeDef* cftm
+				FTM Handler
+ * @param	FTM_OC_InitTypeDef* sConfig
+				PWM Mode & Pulse(CnV)
+ * @param	uint8_t Channel
+				FTM_CHANNEL_0 ~ FTM_CHANNEL_5
+ * @return	CSL_StatusTypeDef
+ * @note	writes one Channel, use CSL_FTM_PWM_SyncUpdate() to change Duties of several
+ *			Channels at the same Period Boundary
+**/
+CSL_StatusTypeDef CSL_FTM_PWM_Config(FTM_HandleTypeDef* cftm, FTM_OC_InitTypeDef* sConfig, uint8_t Channel)
+{
+	if((cftm == NULL) || (sConfig == NULL))
+	{
+		return CSL_Error;
+	}
+	
+	assert_param(IS_FTM_CHANNEL(Channel));
+	assert_param(IS_FTM_OCMode(sConfig->OCMode));
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_DISABLE(cftm->Instance);
+	}
+	
+	cftm->Instance->CONTROLS[Channel].CnSC = sConfig->OCMode;
+	cftm->Instance->CONTROLS[Channel].CnV = sConfig->Pulse;
+	
+	if(cftm->Instance == FTM2)
+	{
+		__CSL_FTM_WP_ENABLE(cftm->Instance);
+	}
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Enable synchronized Duty Update on a Group of FTM2 Channels
+ * @param	FTM_HandleTypeDef* cftm
+				FTM2 Handler(PWM Channels configured by CSL_FTM_PWM_Config())
+ * @param	uint8_t ChannelMask
+				Bit n for FTM_CHANNEL_n, Channels are buffered in Pairs(0/1, 2/3, 4/5)
+ * @return	CSL_StatusTypeDef
+ * @note	CnV of the Group only goes into Write Buffers, a Software Trigger loads all
+ *			of them together when the Counter reaches CNTIN(Start of Period).
+ *			only FTM2 has the Synchronization Logic.
+**/
+CSL_StatusTypeDef CSL_FTM_PWM_SyncInit(FTM_HandleTypeDef* cftm, uint8_t ChannelMask)
+{
+	uint32_t syncen = 0u;
+	
+	if((cftm == NULL) || (cftm->Instance != FTM2) || !IS_FTM_ChannelMask(ChannelMask))
+	{
+		return CSL_Error;
+	}
+	
+	//one SYNCEN Bit per Channel Pair
+	if(ChannelMask & 0x03u)
+	{
+		syncen |= FTM_COMBINE_SYNCEN0_MASK;
+	}
+	if(ChannelMask & 0x0Cu)
+	{
+		syncen |= FTM_COMBINE_SYNCEN1_MASK;
+	}
+	if(ChannelMask & 0x30u)
+	{
+		syncen |= FTM_COMBINE_SYNCEN2_MASK;
+	}
+	
+	__CSL_FTM_WP_DISABLE(cftm->Instance);
+	
+	//Enhanced PWM Synchronization, Software Trigger updates Write Buffers
+	SET_BIT(cftm->Instance->MODE, FTM_MODE_FTMEN_MASK);
+	cftm->Instance->SYNCONF = FTM_SYNCONF_SYNCMODE_MASK | FTM_SYNCONF_SWWRBUF_MASK;
+	SET_BIT(cftm->Instance->COMBINE, syncen);
+	
+	//Loading Point at Start of Period(Valley in Center-aligned Mode)
+	cftm->Instance->SYNC = FTM_SYNC_CNTMIN_MASK;
+	
+	__CSL_FTM_WP_ENABLE(cftm->Instance);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Update Duties of several Channels at the next Period Boundary
+ * @param	FTM_HandleTypeDef* cftm
+				FTM2 Handler(CSL_FTM_PWM_SyncInit() is called)
+ * @param	const uint16_t* pPulse
+				CnV indexed by Channel(pPulse[n] for FTM_CHANNEL_n)
+ * @param	uint8_t ChannelMask
+				Channels to update, inside the Group of CSL_FTM_PWM_SyncInit()
+ * @return	CSL_StatusTypeDef
+				CSL_Busy if the previous Update is not loaded yet, nothing is written then
+ * @note	one Call per Control Cycle, all Channels switch to the new Duties in the same Period
+**/
+CSL_StatusTypeDef CSL_FTM_PWM_SyncUpdate(FTM_HandleTypeDef* cftm, const uint16_t* pPulse, uint8_t ChannelMask)
+{
+	uint8_t i = 0u;
+	
+	if((cftm == NULL) || (pPulse == NULL) || !IS_FTM_ChannelMask(ChannelMask))
+	{
+		return CSL_Error;
+	}
+	
+	//Write Buffers are loaded at the Loading Point after SWSYNC, then SWSYNC is cleared
+	if(cftm->Instance->SYNC & FTM_SYNC_SWSYNC_MASK)
+	{
+		return CSL_Busy;
+	}
+	
+	for(i = 0u; i < 6u; i++)
+	{
+		if(ChannelMask & (1u << i))
+		{
+			cftm->Instance->CONTROLS[i].CnV = pPulse[i];
+		}
+	}
+	
+	SET_BIT(cftm->Instance->SYNC, FTM_SYNC_SWSYNC_MASK);
+	
+	return CSL_OK;
+}
+
+//EOF
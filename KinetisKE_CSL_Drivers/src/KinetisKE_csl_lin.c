@@ -0,0 +1,608 @@
+/**
+ * Title 	LIN module in CSL for KEAZ128(Source File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+#include "KinetisKE_csl_lin.h"
+
+/** LIN Private Functions Declaration(do not call these in user code) **/
+static LIN_FrameTypeDef* LIN_FindFrame(LIN_HandleTypeDef* clin, uint8_t Id);
+static void LIN_SendByte(LIN_HandleTypeDef* clin, uint8_t data);
+static void LIN_StartResponse(LIN_HandleTypeDef* clin);
+static void LIN_SendHeader(LIN_HandleTypeDef* clin);
+static void LIN_EndFrame(LIN_HandleTypeDef* clin, uint32_t Error);
+static void LIN_StartTimeout(LIN_HandleTypeDef* clin);
+
+/** LIN Private Macros **/
+#define LIN_UART(__HANDLE__)				((__HANDLE__)->cuart->Instance)
+#define LIN_PIT(__HANDLE__)					(PIT->CHANNEL[(__HANDLE__)->Init.PIT_Channel])
+#define LIN_PIT_STOP(__HANDLE__)			(LIN_PIT(__HANDLE__).TCTRL &= ~PIT_TCTRL_TEN_MASK)
+#define LIN_PIT_START(__HANDLE__)			(LIN_PIT(__HANDLE__).TCTRL |= PIT_TCTRL_TEN_MASK)
+#define LIN_IS_CLASSIC(__FRAME__)			(((__FRAME__)->Checksum == LIN_Checksum_Classic) || \
+											 ((__FRAME__)->Id == LIN_ID_MASTER_REQUEST) || ((__FRAME__)->Id == LIN_ID_SLAVE_RESPONSE))
+#define LIN_UART_ERRORS						(UART_S1_OR_MASK | UART_S1_NF_MASK | UART_S1_FE_MASK | UART_S1_PF_MASK)
+
+/** LIN Public Functions **/
+/**
+ * @brief	Initialize LIN Engine on an initialized UART
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	CSL_OK/CSL_Error
+ * @note	UART must be initialized by CSL_UART_Init() as 8N1 with Tx & Rx enabled,
+ *			after this function UART is owned by LIN Engine until CSL_LIN_DeInit().
+ *			NVIC of UART & PIT Channel is enabled by User.
+**/
+CSL_StatusTypeDef CSL_LIN_Init(LIN_HandleTypeDef* clin)
+{
+	//Error: LIN Handle is NULL
+	if((clin == NULL) || (clin->cuart == NULL))
+	{
+		goto ERR;
+	}
+
+	//Parameter Check
+	assert_param(IS_LIN_Mode(clin->Init.Mode));
+	assert_param(IS_LIN_PIT_Channel(clin->Init.PIT_Channel));
+
+	//LIN only runs on 8N1 Frames of a ready UART
+	if((clin->cuart->gState != CSL_UART_STATE_READY) || (clin->cuart->Init.WordLength != UART_Word_8B)
+		|| (clin->cuart->Init.Parity != UART_Parity_None))
+	{
+		clin->ErrorCode = CSL_LIN_ERROR_CONFIG;
+		goto ERR;
+	}
+
+	//Master Time Base is necessary
+	if((clin->Init.Mode == LIN_Mode_Master) && (clin->Init.TimeBase == 0u))
+	{
+		clin->ErrorCode = CSL_LIN_ERROR_CONFIG;
+		goto ERR;
+	}
+
+	//UART is owned by LIN Engine
+	clin->cuart->gState = CSL_UART_STATE_BUSY;
+	clin->cuart->RxState = CSL_UART_STATE_BUSY_RX;
+
+	//Break Detection(and 13-bit Break Field for Master)
+	LIN_UART(clin)->S2 &= ~(UART_S2_RXEDGIF_MASK | UART_S2_BRK13_MASK);
+	LIN_UART(clin)->S2 |= UART_S2_LBKDE_MASK;
+	if(clin->Init.Mode == LIN_Mode_Master)
+	{
+		LIN_UART(clin)->S2 |= UART_S2_BRK13_MASK;
+	}
+
+	//PIT Channel: Master Time Base, Slave Response Timeout(loaded per Frame)
+	__CSL_PIT_ENABLE();
+	LIN_PIT(clin).TCTRL = (uint32_t)0x00u;
+	if(clin->Init.Mode == LIN_Mode_Master)
+	{
+		LIN_PIT(clin).LDVAL = clin->Init.TimeBase * (SystemBusClock / 1000000u) - 1u;
+	}
+	__CSL_PIT_FLAG_CLEAR(clin->Init.PIT_Channel);
+	__CSL_PIT_IT_ENABLE(clin->Init.PIT_Channel);
+
+	//Set State
+	clin->pNextSchedule = NULL;
+	clin->pCurrent = NULL;
+	clin->ErrorCode = CSL_LIN_ERROR_NONE;
+	clin->State = CSL_LIN_STATE_READY;
+
+	return CSL_OK;
+
+ERR:
+	return CSL_Error;
+}
+
+/**
+ * @brief	De-Initialize LIN Engine & release UART
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	CSL_OK/CSL_Error
+ * @note
+**/
+CSL_StatusTypeDef CSL_LIN_DeInit(LIN_HandleTypeDef* clin)
+{
+	//Error: LIN Handle is NULL
+	if((clin == NULL) || (clin->cuart == NULL))
+	{
+		return CSL_Error;
+	}
+
+	//Stop Engine
+	CSL_LIN_Stop(clin);
+
+	//Reset PIT Channel
+	LIN_PIT(clin).TCTRL = (uint32_t)0x00u;
+	LIN_PIT(clin).LDVAL = (uint32_t)0x00u;
+	__CSL_PIT_FLAG_CLEAR(clin->Init.PIT_Channel);
+
+	//Disable Break Detection
+	LIN_UART(clin)->S2 &= ~(UART_S2_RXEDGIF_MASK | UART_S2_LBKDE_MASK | UART_S2_BRK13_MASK);
+
+	//Release UART
+	clin->cuart->gState = CSL_UART_STATE_READY;
+	clin->cuart->RxState = CSL_UART_STATE_READY;
+	clin->State = CSL_LIN_STATE_RESET;
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Set Schedule Table of Master
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @param	const LIN_ScheduleTypeDef* pSchedule
+ *				Schedule Table
+ * @param	uint8_t Count
+ *				Entries in Schedule Table
+ * @return	CSL_OK/CSL_Error
+ * @note	While Engine is running, the new Table is taken at the end of current Slot.
+**/
+CSL_StatusTypeDef CSL_LIN_SetSchedule(LIN_HandleTypeDef* clin, const LIN_ScheduleTypeDef* pSchedule, uint8_t Count)
+{
+	if((clin == NULL) || (pSchedule == NULL) || (Count == 0u) || (clin->Init.Mode != LIN_Mode_Master))
+	{
+		return CSL_Error;
+	}
+
+	if(clin->State == CSL_LIN_STATE_READY)
+	{
+		//Engine is stopped, take it now
+		clin->pSchedule = pSchedule;
+		clin->ScheduleCount = Count;
+		clin->ScheduleIndex = 0u;
+	}
+	else
+	{
+		//Pointer is written last, PIT ISR takes both at the Slot end
+		clin->NextScheduleCount = Count;
+		clin->pNextSchedule = pSchedule;
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Start LIN Engine
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	CSL_OK/CSL_Error
+ * @note	Master starts the Schedule Table from its first entry,
+ *			Slave starts listening to Break Fields.
+**/
+CSL_StatusTypeDef CSL_LIN_Start(LIN_HandleTypeDef* clin)
+{
+	if((clin == NULL) || (clin->State != CSL_LIN_STATE_READY))
+	{
+		return CSL_Error;
+	}
+
+	if((clin->Init.Mode == LIN_Mode_Master) && (clin->pSchedule == NULL))
+	{
+		return CSL_Error;
+	}
+
+	clin->ErrorCode = CSL_LIN_ERROR_NONE;
+	clin->pCurrent = NULL;
+	clin->State = CSL_LIN_STATE_IDLE;
+
+	//Enable Break, Receive and Error Interrupts
+	__CSL_UART_CLEAR_LBKDIF(clin->cuart);
+	LIN_UART(clin)->BDH |= UART_BDH_LBKDIE_MASK;
+	LIN_UART(clin)->C3 |= UART_C3_ORIE_MASK | UART_C3_NEIE_MASK | UART_C3_FEIE_MASK;
+	LIN_UART(clin)->C2 |= UART_C2_RIE_MASK;
+
+	//Master: first Header is sent at first Time Base Tick
+	if(clin->Init.Mode == LIN_Mode_Master)
+	{
+		clin->ScheduleIndex = 0u;
+		clin->SlotCount = 0u;
+		LIN_PIT_START(clin);
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop LIN Engine
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	CSL_OK/CSL_Error
+ * @note	Frame in progress is dropped without Callback.
+**/
+CSL_StatusTypeDef CSL_LIN_Stop(LIN_HandleTypeDef* clin)
+{
+	if(clin == NULL)
+	{
+		return CSL_Error;
+	}
+
+	//Disable Interrupts & Timer
+	LIN_PIT_STOP(clin);
+	LIN_UART(clin)->C2 &= ~(UART_C2_RIE_MASK | UART_C2_SBK_MASK);
+	LIN_UART(clin)->C3 &= ~(UART_C3_ORIE_MASK | UART_C3_NEIE_MASK | UART_C3_FEIE_MASK);
+	LIN_UART(clin)->BDH &= ~UART_BDH_LBKDIE_MASK;
+	__CSL_PIT_FLAG_CLEAR(clin->Init.PIT_Channel);
+
+	//Take pending Schedule Table
+	if(clin->pNextSchedule != NULL)
+	{
+		clin->pSchedule = clin->pNextSchedule;
+		clin->ScheduleCount = clin->NextScheduleCount;
+		clin->pNextSchedule = NULL;
+	}
+
+	clin->pCurrent = NULL;
+	clin->State = CSL_LIN_STATE_READY;
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Calculate Protected Identifier
+ * @param	uint8_t Id
+ *				Frame Identifier(0x00 ~ 0x3F)
+ * @return	PID with P0(bit6) & P1(bit7)
+ * @note	P0 = ID0^ID1^ID2^ID4, P1 = ~(ID1^ID3^ID4^ID5)
+**/
+uint8_t CSL_LIN_GetPID(uint8_t Id)
+{
+	uint8_t p0 = ((Id >> 0) ^ (Id >> 1) ^ (Id >> 2) ^ (Id >> 4)) & 0x01u;
+	uint8_t p1 = (~((Id >> 1) ^ (Id >> 3) ^ (Id >> 4) ^ (Id >> 5))) & 0x01u;
+
+	return (uint8_t)((Id & 0x3Fu) | (p0 << 6) | (p1 << 7));
+}
+
+/**
+ * @brief	LIN Interrupt Service Requestion of UART
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	None
+ * @note	Call this instead of CSL_UART_IRQHandler() in UARTx_IRQHandler().
+**/
+void CSL_LIN_IRQHandler(LIN_HandleTypeDef* clin)
+{
+	UART_Type* uart = LIN_UART(clin);
+	uint8_t data = 0u;
+
+	//Break Field detected(Master: own Break, Slave: new Header)
+	if(__CSL_UART_GET_FLAG(uart->S2, UART_S2_LBKDIF_MASK) == SET)
+	{
+		__CSL_UART_CLEAR_LBKDIF(clin->cuart);
+
+		//Unfinished Response of Slave is broken by new Header
+		if((clin->Init.Mode == LIN_Mode_Slave) && (clin->State >= CSL_LIN_STATE_TX_DATA))
+		{
+			LIN_EndFrame(clin, (clin->Index == 0u) ? CSL_LIN_ERROR_NORESPONSE : CSL_LIN_ERROR_TIMEOUT);
+		}
+
+		if(clin->Init.Mode == LIN_Mode_Master)
+		{
+			if(clin->State == CSL_LIN_STATE_BREAK)
+			{
+				LIN_SendByte(clin, LIN_SYNC_FIELD);
+				clin->State = CSL_LIN_STATE_SYNC;
+			}
+		}
+		else if(clin->State != CSL_LIN_STATE_READY)
+		{
+			LIN_PIT_STOP(clin);
+			clin->State = CSL_LIN_STATE_SYNC;
+		}
+
+		return;
+	}
+
+	//Framing/Noise/Overrun Error, current Frame is dropped
+	if((uart->S1 & LIN_UART_ERRORS) != 0u)
+	{
+		(void)uart->D;
+		if(clin->State >= CSL_LIN_STATE_SYNC)
+		{
+			LIN_EndFrame(clin, CSL_LIN_ERROR_UART);
+		}
+		return;
+	}
+
+	if(__CSL_UART_GET_FLAG(uart->S1, UART_S1_RDRF_MASK) != SET)
+	{
+		return;
+	}
+	data = uart->D;
+
+	switch(clin->State)
+	{
+	case CSL_LIN_STATE_SYNC:
+		if(data != LIN_SYNC_FIELD)
+		{
+			LIN_EndFrame(clin, CSL_LIN_ERROR_SYNC);
+			break;
+		}
+
+		//Master sends PID after Sync Field readback, Slave waits for it
+		if(clin->Init.Mode == LIN_Mode_Master)
+		{
+			LIN_SendByte(clin, clin->PID);
+		}
+		clin->State = CSL_LIN_STATE_PID;
+		break;
+
+	case CSL_LIN_STATE_PID:
+		if((clin->Init.Mode == LIN_Mode_Master) ? (data != clin->PID) : (data != CSL_LIN_GetPID(data)))
+		{
+			LIN_EndFrame(clin, (clin->Init.Mode == LIN_Mode_Master) ? CSL_LIN_ERROR_BIT : CSL_LIN_ERROR_PID);
+			break;
+		}
+
+		if(clin->Init.Mode == LIN_Mode_Slave)
+		{
+			clin->PID = data;
+			clin->pCurrent = LIN_FindFrame(clin, data & 0x3Fu);
+		}
+		LIN_StartResponse(clin);
+		break;
+
+	case CSL_LIN_STATE_TX_DATA:
+		//Readback of the Byte just sent
+		if(data != clin->TxByte)
+		{
+			LIN_EndFrame(clin, CSL_LIN_ERROR_BIT);
+			break;
+		}
+
+		clin->Index++;
+		if(clin->Index < clin->pCurrent->Length)
+		{
+			data = clin->pCurrent->Data[clin->Index];
+			clin->Sum += data;
+			clin->Sum = (clin->Sum & 0xFFu) + (clin->Sum >> 8);
+			LIN_SendByte(clin, data);
+		}
+		else if(clin->Index == clin->pCurrent->Length)
+		{
+			LIN_SendByte(clin, (uint8_t)(~clin->Sum));
+		}
+		else
+		{
+			LIN_EndFrame(clin, CSL_LIN_ERROR_NONE);
+		}
+		break;
+
+	case CSL_LIN_STATE_RX_DATA:
+		if(clin->Index < clin->pCurrent->Length)
+		{
+			clin->Buffer[clin->Index++] = data;
+			clin->Sum += data;
+			clin->Sum = (clin->Sum & 0xFFu) + (clin->Sum >> 8);
+		}
+		else if((uint8_t)(clin->Sum + data) == 0xFFu)
+		{
+			//Sum of Data and its inverted Checksum is 0xFF
+			for(data = 0u; data < clin->pCurrent->Length; data++)
+			{
+				clin->pCurrent->Data[data] = clin->Buffer[data];
+			}
+			LIN_EndFrame(clin, CSL_LIN_ERROR_NONE);
+		}
+		else
+		{
+			LIN_EndFrame(clin, CSL_LIN_ERROR_CHECKSUM);
+		}
+		break;
+
+	default:
+		//Response of other Nodes or Bus Noise, ignored
+		break;
+	}
+}
+
+/**
+ * @brief	LIN Interrupt Service Requestion of PIT Channel
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	None
+ * @note	Master: Time Base Tick of Schedule Table,
+ *			Slave: Response Timeout.
+**/
+void CSL_LIN_PIT_IRQHandler(LIN_HandleTypeDef* clin)
+{
+	__CSL_PIT_FLAG_CLEAR(clin->Init.PIT_Channel);
+
+	if(clin->Init.Mode == LIN_Mode_Slave)
+	{
+		LIN_PIT_STOP(clin);
+		if(clin->State >= CSL_LIN_STATE_TX_DATA)
+		{
+			LIN_EndFrame(clin, (clin->Index == 0u) ? CSL_LIN_ERROR_NORESPONSE : CSL_LIN_ERROR_TIMEOUT);
+		}
+		return;
+	}
+
+	//Current Slot is not over
+	if(clin->SlotCount > 1u)
+	{
+		clin->SlotCount--;
+		return;
+	}
+
+	//Frame is not finished in its Slot
+	if(clin->State > CSL_LIN_STATE_IDLE)
+	{
+		LIN_EndFrame(clin, ((clin->State == CSL_LIN_STATE_RX_DATA) && (clin->Index == 0u))
+						   ? CSL_LIN_ERROR_NORESPONSE : CSL_LIN_ERROR_TIMEOUT);
+	}
+
+	//New Schedule Table starts from its first entry
+	if(clin->pNextSchedule != NULL)
+	{
+		clin->pSchedule = clin->pNextSchedule;
+		clin->ScheduleCount = clin->NextScheduleCount;
+		clin->ScheduleIndex = 0u;
+		clin->pNextSchedule = NULL;
+	}
+
+	LIN_SendHeader(clin);
+}
+
+/**
+ * @brief	LIN Frame Complete Callback
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @param	LIN_FrameTypeDef* pFrame
+ *				Frame sent or received(Data is updated for Subscribed Frames)
+ * @return	None
+ * @note	Called in ISR, Publish Data can be updated here for next Frame.
+**/
+__weak void CSL_LIN_FrameCpltCallback(LIN_HandleTypeDef* clin, LIN_FrameTypeDef* pFrame)
+{
+	UNUSED(clin);
+	UNUSED(pFrame);
+}
+
+/**
+ * @brief	LIN Error Callback
+ * @param	LIN_HandleTypeDef* clin
+ *				LIN Handle
+ * @return	None
+ * @note	clin->ErrorCode & clin->pCurrent describe the failed Frame.
+**/
+__weak void CSL_LIN_ErrorCallback(LIN_HandleTypeDef* clin)
+{
+	UNUSED(clin);
+}
+
+/** LIN Private Functions **/
+/**
+ * @brief	Find Frame in Frame Table of this Node
+**/
+static LIN_FrameTypeDef* LIN_FindFrame(LIN_HandleTypeDef* clin, uint8_t Id)
+{
+	uint8_t i = 0u;
+
+	for(i = 0u; i < clin->FrameCount; i++)
+	{
+		if(clin->pFrames[i].Id == Id)
+		{
+			return &clin->pFrames[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief	Send one Byte & remember it for Readback
+**/
+static void LIN_SendByte(LIN_HandleTypeDef* clin, uint8_t data)
+{
+	clin->TxByte = data;
+	(void)LIN_UART(clin)->S1;
+	LIN_UART(clin)->D = data;
+}
+
+/**
+ * @brief	Start Response after a valid PID
+**/
+static void LIN_StartResponse(LIN_HandleTypeDef* clin)
+{
+	LIN_FrameTypeDef* frame = clin->pCurrent;
+
+	//Response is not for this Node
+	if((frame == NULL) || (frame->Direction == LIN_Frame_Ignore))
+	{
+		clin->pCurrent = NULL;
+		clin->State = CSL_LIN_STATE_IDLE;
+		return;
+	}
+
+	assert_param(IS_LIN_Length(frame->Length));
+
+	clin->Index = 0u;
+	clin->Sum = LIN_IS_CLASSIC(frame) ? 0u : clin->PID;
+
+	if(clin->Init.Mode == LIN_Mode_Slave)
+	{
+		LIN_StartTimeout(clin);
+	}
+
+	if(frame->Direction == LIN_Frame_Publish)
+	{
+		clin->State = CSL_LIN_STATE_TX_DATA;
+		clin->Sum += frame->Data[0];
+		clin->Sum = (clin->Sum & 0xFFu) + (clin->Sum >> 8);
+		LIN_SendByte(clin, frame->Data[0]);
+	}
+	else
+	{
+		clin->State = CSL_LIN_STATE_RX_DATA;
+	}
+}
+
+/**
+ * @brief	Send Break Field of next Schedule entry(Master)
+ * @note	Sync Field follows the detection of own Break Field.
+**/
+static void LIN_SendHeader(LIN_HandleTypeDef* clin)
+{
+	const LIN_ScheduleTypeDef* entry = NULL;
+
+	if(clin->ScheduleIndex >= clin->ScheduleCount)
+	{
+		clin->ScheduleIndex = 0u;
+	}
+	entry = &clin->pSchedule[clin->ScheduleIndex++];
+	assert_param(IS_LIN_ID(entry->Id));
+
+	clin->SlotCount = entry->Slots;
+	clin->PID = CSL_LIN_GetPID(entry->Id);
+	clin->pCurrent = LIN_FindFrame(clin, entry->Id);
+	clin->State = CSL_LIN_STATE_BREAK;
+
+	//Queue one 13-bit Break Character
+	LIN_UART(clin)->C2 |= UART_C2_SBK_MASK;
+	LIN_UART(clin)->C2 &= ~UART_C2_SBK_MASK;
+}
+
+/**
+ * @brief	End current Frame & call back
+**/
+static void LIN_EndFrame(LIN_HandleTypeDef* clin, uint32_t Error)
+{
+	LIN_FrameTypeDef* frame = clin->pCurrent;
+
+	if(clin->Init.Mode == LIN_Mode_Slave)
+	{
+		LIN_PIT_STOP(clin);
+	}
+	clin->State = CSL_LIN_STATE_IDLE;
+
+	if(Error == CSL_LIN_ERROR_NONE)
+	{
+		CSL_LIN_FrameCpltCallback(clin, frame);
+	}
+	else
+	{
+		clin->ErrorCode |= Error;
+		CSL_LIN_ErrorCallback(clin);
+	}
+
+	clin->pCurrent = NULL;
+}
+
+/**
+ * @brief	Start Response Timeout of Slave
+ * @note	TResponse_Max = 1.4 * 10 * (N + 1) Bit Times
+**/
+static void LIN_StartTimeout(LIN_HandleTypeDef* clin)
+{
+	uint32_t bits = 14u * ((uint32_t)clin->pCurrent->Length + 1u);
+
+	LIN_PIT_STOP(clin);
+	LIN_PIT(clin).LDVAL = (SystemBusClock / clin->cuart->Init.BuadRate) * bits - 1u;
+	__CSL_PIT_FLAG_CLEAR(clin->Init.PIT_Channel);
+	LIN_PIT_START(clin);
+}
+
+//EOF
@@ -148,9 +148,9 @@ void CSL_PMC_EnterWaitMode(uint8_t LowPowerEntry)
  * @return	None
  * @note	None
 **/
-void CSL_PMC_EnterStopMode(uint8_t LowPowerEntry)
+void CSL_PMC_EnterSTOPMode(uint8_t LowPowerEntry)
 {
-	/* Clear SLEEPDEEP bit of Cortex System Control Register */
+	/* Set SLEEPDEEP bit of Cortex System Control Register */
 	SET_BIT(SCB->SCR, ((uint32_t)SCB_SCR_SLEEPDEEP_Msk));
 
 	/* Select SLEEP mode entry -------------------------------------------------*/
@@ -10,13 +10,26 @@
 /* Private Functions Declerations of SPI */
 static void SPI_Config(SPI_HandleTypeDef* cspi);
 static CSL_StatusTypeDef SPI_WaitFlag(SPI_HandleTypeDef* cspi, uint8_t Flag, Flag_Status Status, uint32_t TickStart, uint32_t Timeout);
+static void SPI_Start_IT(SPI_HandleTypeDef* cspi);
 static void SPI_TxISR(struct __SPI_HandleTypeDef* cspi);
 static void SPI_RxISR(struct __SPI_HandleTypeDef* cspi);
-static void SPI_2LinesTxISR(struct __SPI_HandleTypeDef* cspi);
-static void SPI_2LinesRxISR(struct __SPI_HandleTypeDef* cspi);
-static void SPI_CloseTxISR(struct __SPI_HandleTypeDef* cspi);
-static void SPI_CloseRxISR(struct __SPI_HandleTypeDef* cspi);
 static void SPI_CloseTxRxISR(struct __SPI_HandleTypeDef* cspi);
+static void SPI_Queue_Start(SPI_HandleTypeDef* cspi);
+static void SPI_Queue_End(SPI_HandleTypeDef* cspi, CSL_StatusTypeDef Status);
+static void SPI_Queue_Kick(SPI_HandleTypeDef* cspi);
+static void SPI_Queue_Flush(SPI_HandleTypeDef* cspi);
+static CSL_StatusTypeDef SPI_Claim(SPI_HandleTypeDef* cspi, SPI_StateTypeDef State);
+static void SPI_SlaveTxISR(struct __SPI_HandleTypeDef* cspi);
+static void SPI_SlaveRxISR(struct __SPI_HandleTypeDef* cspi);
+static void SPI_SlaveFrame(SPI_HandleTypeDef* cspi);
+static void SPI_UpdateBaudRate(SPI_HandleTypeDef* cspi);
+
+/* Private Macros of SPI */
+#define SPI_QUEUE_MASK					((uint8_t)(SPI_QUEUE_DEPTH - 1u))
+#define SPI_QUEUE_COUNT(__HANDLE__)		((uint8_t)((__HANDLE__)->QHead - (__HANDLE__)->QTail))
+#define SPI_GET_IRQn(__HANDLE__)		(((__HANDLE__)->Instance == SPI0) ? SPI0_IRQn : SPI1_IRQn)
+//Polling Loops without progress between two Tick reads
+#define SPI_POLL_SPIN					0x40u
 
 
 /* Public Functions Definations of SPI */
@@ -32,6 +45,16 @@ CSL_StatusTypeDef CSL_SPI_Init(SPI_HandleTypeDef* cspi)
 	if(cspi == NULL)
 		return CSL_Error;
 	
+	//Solve PreScaler & Scaler from Target BaudRate
+	if(cspi->Init.BaudRate != 0u)
+	{
+		if(CSL_SPI_CalcBaudRate(SystemBusClock, cspi->Init.BaudRate, &cspi->Init.PreScaler, &cspi->Init.Scaler) == 0u)
+		{
+			return CSL_Error;
+		}
+	}
+	cspi->BusClock = SystemBusClock;
+	
 	assert_param(IS_SPI_BAUDRATEPSC(cspi->Init.PreScaler));
 	assert_param(IS_SPI_BAUDRATESC(cspi->Init.Scaler));
 	assert_param(IS_SPI_MODE(cspi->Init.Mode));
@@ -43,6 +66,15 @@ CSL_StatusTypeDef CSL_SPI_Init(SPI_HandleTypeDef* cspi)
 	//Configure SPI
 	SPI_Config(cspi);
 	
+	//Reset Transaction Queue
+	cspi->QHead = 0u;
+	cspi->QTail = 0u;
+	cspi->pXfer = NULL;
+	cspi->pDevice = NULL;
+	cspi->RxSkip = 0u;
+	cspi->Slave.pRing = NULL;
+	cspi->pTxTable = NULL;
+	
 	//Msp Init
 	if(cspi->gState == CSL_SPI_STATE_RESET)
 	{
@@ -132,10 +164,10 @@ CSL_StatusTypeDef CSL_SPI_Transmit(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, u
 	//Init TickStart for Timeout Management
 	tickstart = CSL_GetTick();
 	
-	if(cspi->gState != CSL_SPI_STATE_READY)
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX) != CSL_OK)
 	{
-		errcode = CSL_Busy;
-		goto ERROR;
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
 	}
 	
 	if((TxBuffer == NULL) || (Size == 0u))
@@ -145,11 +177,11 @@ CSL_StatusTypeDef CSL_SPI_Transmit(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, u
 	}
 	
 	//Set transcation Information
-	cspi->gState = CSL_SPI_STATE_BUSY_TX;
 	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
 	cspi->pTxBuffer = TxBuffer;
 	cspi->pTxXferCount = Size;
 	cspi->pTxXferSize = Size;
+	SPI_UpdateBaudRate(cspi);
 	
 	//Init field not used in handle to zero
 	cspi->pRxBuffer = NULL;
@@ -206,6 +238,8 @@ CSL_StatusTypeDef CSL_SPI_Transmit(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, u
 	
 ERROR:
 	cspi->gState = CSL_SPI_STATE_READY;
+	//Transactions submitted during this Transfer
+	SPI_Queue_Kick(cspi);
 	//Process Unlock
 	__CSL_UNLOCK(cspi);
 	return errcode;
@@ -231,10 +265,10 @@ CSL_StatusTypeDef CSL_SPI_Receive(SPI_HandleTypeDef* cspi, uint8_t* RxBuffer, ui
 	//Init TickStart for Timeout Management
 	tickstart = CSL_GetTick();
 	
-	if(cspi->gState != CSL_SPI_STATE_READY)
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_RX) != CSL_OK)
 	{
-		errcode = CSL_Busy;
-		goto ERROR;
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
 	}
 	
 	if((RxBuffer == NULL) || (Size == 0u))
@@ -244,11 +278,11 @@ CSL_StatusTypeDef CSL_SPI_Receive(SPI_HandleTypeDef* cspi, uint8_t* RxBuffer, ui
 	}
 	
 	//Set receipient Information
-	cspi->gState = CSL_SPI_STATE_BUSY_RX;
 	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
 	cspi->pRxBuffer = RxBuffer;
 	cspi->pRxXferCount = Size;
 	cspi->pRxXferSize = Size;
+	SPI_UpdateBaudRate(cspi);
 	
 	//Init field not used in handle to zero
 	cspi->pTxBuffer = NULL;
@@ -305,26 +339,39 @@ CSL_StatusTypeDef CSL_SPI_Receive(SPI_HandleTypeDef* cspi, uint8_t* RxBuffer, ui
 	
 ERROR:
 	cspi->gState = CSL_SPI_STATE_READY;
+	//Transactions submitted during this Transfer
+	SPI_Queue_Kick(cspi);
 	//Process unlock
 	__CSL_UNLOCK(cspi);
 	return errcode;
 }
 
 /**
- * @brief	
- * @param
- * @return 
- * @note
+ * @brief	SPI Transmit & Receive Function in Polling
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			uint8_t* TxBuffer
+ *				Data to be sent
+ *			uint8_t* RxBuffer
+ *				Buffer of received Data
+ *			uint16_t Size
+ *				Size of Data
+ *			uint32_t Timeout
+ *				Timeout in ms
+ * @return	CSL_StatusTypeDef
+ * @note	Next Byte is written only after the previous one is read(one Byte in flight),
+ *			SPI has no Overrun Flag, so a late Read can not lose a Byte even if the Loop is
+ *			preempted. Tick is read only after SPI_POLL_SPIN Loops without progress,
+ *			Timeout may be detected up to that many Loops late.
 **/
 CSL_StatusTypeDef CSL_SPI_TransmitReceive(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t Size, uint32_t Timeout)
 {
 	//Parameters Check
 	assert_param(IS_SPI_DIRECTIONS(cspi->Init.Direction));
 	
-	uint8_t tmp = 0u, tmp1 = 0u;
+	uint8_t s_flag = 0u;
+	uint32_t spin = 0u;
 	uint32_t tickstart = 0u;
-	// Variable used to alternate Rx and Tx during transfer 
-  	uint32_t txallowed = 1u;
 	CSL_StatusTypeDef errcode = CSL_OK;
 	
 	//Process lock
@@ -333,28 +380,18 @@ CSL_StatusTypeDef CSL_SPI_TransmitReceive(SPI_HandleTypeDef* cspi, uint8_t* TxBu
 	//Init tick start for timeout management
 	tickstart = CSL_GetTick();
 	
-	tmp = cspi->gState;
-	tmp1 = cspi->Init.Mode;
-	
-	if(!((tmp == CSL_SPI_STATE_READY) || \
-		((tmp1 == SPI_MODE_MASTER) && (cspi->Init.Direction == SPI_DIRECTION_2LINES) && (tmp == CSL_SPI_STATE_BUSY_RX))))
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX_RX) != CSL_OK)
 	{
-		errcode = CSL_Busy;
-		goto ERROR;
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
 	}
 	
-	if((TxBuffer == NULL) || (RxBuffer == NULL) || (Size == 0u))
+	if((TxBuffer == NULL) || (RxBuffer == NULL) || (Size == 0u) || (cspi->Init.Direction != SPI_DIRECTION_2LINES))
 	{
 		errcode = CSL_Error;
 		goto ERROR;
 	}
 	
-	//Do not overwrite in case of CSL_SPI_STATE_BUSY_RX
-	if(cspi->gState == CSL_SPI_STATE_READY)
-	{
-		cspi->gState = CSL_SPI_STATE_BUSY_TX_RX;
-	}
-	
 	/* Set the transaction information */
 	cspi->ErrorCode   	= CSL_SPI_ERROR_NONE;
 	cspi->pRxBuffer  	= RxBuffer;
@@ -367,6 +404,7 @@ CSL_StatusTypeDef CSL_SPI_TransmitReceive(SPI_HandleTypeDef* cspi, uint8_t* TxBu
 	/*Init field not used in handle to zero */
 	cspi->RxISR       	= NULL;
 	cspi->TxISR       	= NULL;
+	SPI_UpdateBaudRate(cspi);
 	
 	//Check SPI is enabled or not
 	if((cspi->Instance->C1 & SPI_C1_SPE_MASK) == 0x00u)
@@ -374,190 +412,1366 @@ CSL_StatusTypeDef CSL_SPI_TransmitReceive(SPI_HandleTypeDef* cspi, uint8_t* TxBu
 		__CSL_SPI_ENABLE(cspi);
 	}
 	
-	// Transmit and Receive data in 8 Bit mode 
-	if((cspi->Init.Mode == SPI_MODE_SLAVE) || (cspi->pTxXferCount == 1u))
+	//Flush stale Data
+	if(__CSL_SPI_GET_FLAG(cspi, SPI_S_SPRF_MASK))
 	{
-		*((__IO uint8_t*)&cspi->Instance->D) = *(cspi->pTxBuffer);
-		cspi->pTxBuffer += sizeof(uint8_t);
-		cspi->pTxXferCount--;
+		__CSL_SPI_FLUSH_DR(cspi);
 	}
-	while((cspi->pRxXferCount > 0u) || (cspi->pTxXferCount > 0u))
+	
+	//First Byte goes to Tx Buffer(reading S arms SPTEF clearing)
+	(void)cspi->Instance->S;
+	*((__IO uint8_t*)&cspi->Instance->D) = *(cspi->pTxBuffer++);
+	cspi->pTxXferCount--;
+	
+	while(cspi->pRxXferCount > 0u)
 	{
-		//Check SPTEF flag
-		if(txallowed && (cspi->pTxXferCount > 0u) && (__CSL_SPI_GET_FLAG(cspi, SPI_S_SPTEF_MASK)))
+		//One read of S arms both SPTEF & SPRF clearing sequences
+		s_flag = cspi->Instance->S;
+		
+		//Previous Byte is read, send the next one
+		if((cspi->pTxXferCount > 0u) && ((s_flag & SPI_S_SPTEF_MASK) != RESET) && \
+		   (cspi->pRxXferCount == cspi->pTxXferCount))
 		{
 			*((__IO uint8_t*)&cspi->Instance->D) = *(cspi->pTxBuffer++);
 			cspi->pTxXferCount--;
-			txallowed = 0u;
+			spin = 0u;
 		}
 		
-		//wait until SPRF flag is RESET
-		if((cspi->pRxXferCount > 0u) && (__CSL_SPI_GET_FLAG(cspi, SPI_S_SPRF_MASK)))
+		if((s_flag & SPI_S_SPRF_MASK) != RESET)
 		{
-			(*(uint8_t *)RxBuffer++) = cspi->Instance->D;
+			*(cspi->pRxBuffer++) = *((__IO uint8_t*)&cspi->Instance->D);
 			cspi->pRxXferCount--;
-			/* Next Data is a Transmission (Tx). Tx is allowed */ 
-			txallowed = 1u;
+			spin = 0u;
+			continue;
 		}
-		if((Timeout != CSL_MAX_DELAY) && ((CSL_GetTick()-tickstart) >=  Timeout))
+		
+		//Timeout is checked only when the Bus makes no progress
+		if(++spin >= SPI_POLL_SPIN)
 		{
-			errcode = CSL_Timeout;
-			goto ERROR;
+			spin = 0u;
+			if((Timeout != CSL_MAX_DELAY) && ((CSL_GetTick()-tickstart) >=  Timeout))
+			{
+				errcode = CSL_Timeout;
+				goto ERROR;
+			}
 		}
 	}
 	
-	/* Wait until TXE flag */
-	
-	if(SPI_WaitFlag(cspi, SPI_S_SPTEF_MASK, SET, Timeout, tickstart) != CSL_OK)
-	{
-		errcode = CSL_Timeout;
-		goto ERROR;
-	}
+	//The last Byte is received, Shifter is idle
 	
 ERROR:
 	cspi->gState = CSL_SPI_STATE_READY;
+	//Transactions submitted during this Transfer
+	SPI_Queue_Kick(cspi);
 	//Process unlock
 	__CSL_UNLOCK(cspi);
 	return errcode;
 }
 
 /**
- * @brief 	Get SPI current Status
- * @param
- * @return 
- * @note
-**/
-SPI_StateTypeDef CSL_SPI_GetState(SPI_HandleTypeDef* cspi)
-{
-	return cspi->gState;
-}
-
-/**
- * @brief	Get SPI Error Code
- * @param
- * @return 
- * @note
-**/
-uint8_t CSL_SPI_GetError(SPI_HandleTypeDef* cspi)
-{
-	return cspi->ErrorCode;
-}
-
-/**
- * @brief 	Get SPI BaudRate in bps(bits/s)
- * @param
- * @return 
- * @note
+ * @brief	SPI Transmit Function in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			uint8_t* TxBuffer
+ *				Data to be sent
+ *			uint16_t Size
+ *				Size of Data
+ * @return	CSL_StatusTypeDef
+ * @note	Received Bytes are discarded, CSL_SPI_TxCpltCallback() is called
+ *			when the last Byte is shifted out.
 **/
-uint32_t CSL_SPI_GetBaudRate(SPI_HandleTypeDef* cspi)
+CSL_StatusTypeDef CSL_SPI_Transmit_IT(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, uint16_t Size)
 {
-	uint16_t psc = 0, sc = 0;
+	if((TxBuffer == NULL) || (Size == 0u))
+	{
+		return CSL_Error;
+	}
 	
-	psc = (cspi->Init.PreScaler) >> SPI_BR_SPPR_SHIFT;
-	sc = 1 << (cspi->Init.Scaler + 1u);
-	return (uint32_t)(SystemBusClock / (psc+1) / sc);
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX) != CSL_OK)
+	{
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
+	}
+	
+	//Set transcation Information
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	cspi->pTxBuffer = TxBuffer;
+	cspi->pTxXferCount = Size;
+	cspi->pTxXferSize = Size;
+	cspi->pTxVec = NULL;
+	cspi->TxVecCount = 0u;
+	cspi->pRxBuffer = NULL;
+	cspi->pRxXferCount = Size;
+	cspi->pRxXferSize = Size;
+	
+	//Commucate Directions: 1Line
+	if(cspi->Init.Direction == SPI_DIRECTION_1LINES)
+	{
+		__CSL_SPI_1Line_Tx(cspi);
+	}
+	
+	SPI_Start_IT(cspi);
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	return CSL_OK;
 }
 
 /**
- * @brief 	Get SPI match value
- * @param
- * @return 
- * @note
+ * @brief	SPI Receive Function in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			uint8_t* RxBuffer
+ *				Buffer of received Data
+ *			uint16_t Size
+ *				Size of Data
+ * @return	CSL_StatusTypeDef
+ * @note	Master sends 0xFF to generate the Clock.
 **/
-uint8_t CSL_SPI_GetMatchValue(SPI_HandleTypeDef* cspi)
+CSL_StatusTypeDef CSL_SPI_Receive_IT(SPI_HandleTypeDef* cspi, uint8_t* RxBuffer, uint16_t Size)
 {
-	return cspi->Instance->M;
+	if((RxBuffer == NULL) || (Size == 0u))
+	{
+		return CSL_Error;
+	}
+	
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_RX) != CSL_OK)
+	{
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
+	}
+	
+	//Set receipient Information
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	cspi->pRxBuffer = RxBuffer;
+	cspi->pRxXferCount = Size;
+	cspi->pRxXferSize = Size;
+	cspi->pTxBuffer = NULL;
+	cspi->pTxXferCount = Size;
+	cspi->pTxXferSize = Size;
+	cspi->pTxVec = NULL;
+	cspi->TxVecCount = 0u;
+	
+	//Commucate Directions: 1Line
+	if(cspi->Init.Direction != SPI_DIRECTION_2LINES)
+	{
+		__CSL_SPI_1Line_Rx(cspi);
+	}
+	
+	SPI_Start_IT(cspi);
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	return CSL_OK;
 }
 
 /**
- * @brief	Set SPI Match Value
- * @param
- * @return 
- * @note
+ * @brief	SPI Transmit & Receive Function in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			uint8_t* TxBuffer
+ *				Data to be sent
+ *			uint8_t* RxBuffer
+ *				Buffer of received Data
+ *			uint16_t Size
+ *				Size of Data
+ * @return	CSL_StatusTypeDef
+ * @note	only for SPI_DIRECTION_2LINES
 **/
-void CSL_SPI_SetMatchValue(SPI_HandleTypeDef* cspi, uint8_t match)
+CSL_StatusTypeDef CSL_SPI_TransmitReceive_IT(SPI_HandleTypeDef* cspi, uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t Size)
 {
-	if(cspi->Init.Match == SPI_MATCH_ENABLE)
+	if((TxBuffer == NULL) || (RxBuffer == NULL) || (Size == 0u) || (cspi->Init.Direction != SPI_DIRECTION_2LINES))
 	{
-		cspi->Init.MatchValue = match;
-		cspi->Instance->M = match;
+		return CSL_Error;
 	}
-	else return;
+	
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX_RX) != CSL_OK)
+	{
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
+	}
+	
+	/* Set the transaction information */
+	cspi->ErrorCode   	= CSL_SPI_ERROR_NONE;
+	cspi->pRxBuffer  	= RxBuffer;
+	cspi->pRxXferCount 	= Size;
+	cspi->pRxXferSize  	= Size;
+	cspi->pTxBuffer  	= TxBuffer;
+	cspi->pTxXferCount 	= Size;
+	cspi->pTxXferSize  	= Size;
+	cspi->pTxVec		= NULL;
+	cspi->TxVecCount	= 0u;
+	
+	SPI_Start_IT(cspi);
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	return CSL_OK;
 }
 
-/* Private Functions Definations of SPI */
 /**
- * @brief 	Configure SPI
+ * @brief	SPI Vectored Transmit Function in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			const CSL_IOVecTypeDef* pVec
+ *				Segments to be sent in order(empty Segments are skipped)
+ *			uint8_t Count
+ *				Number of Segments
+ * @return	CSL_StatusTypeDef
+ * @note	Segments are sent without copying, pVec and all of Segments must stay
+ *			valid until CSL_SPI_TxCpltCallback(), which is called once for the whole Vector.
+ *			Total Size must not be larger than 65535.
 **/
-static void SPI_Config(SPI_HandleTypeDef* cspi)
+CSL_StatusTypeDef CSL_SPI_TransmitV_IT(SPI_HandleTypeDef* cspi, const CSL_IOVecTypeDef* pVec, uint8_t Count)
 {
-	/* write SPIx->C1 */
-	cspi->Instance->C1 = cspi->Init.Mode | cspi->Init.CLKPolarity | cspi->Init.CLKPhase | cspi->Init.FirstBit;
+	uint32_t total = 0u;
+	uint8_t i = 0u;
 	
-	/* write SPIx->BR */
-	cspi->Instance->BR = cspi->Init.PreScaler | cspi->Init.Scaler;
+	if((pVec == NULL) || (Count == 0u))
+	{
+		return CSL_Error;
+	}
 	
-	/* configure NSS pin */
-	//no NSS(SS pin is GPIO)
-	if(cspi->Init.NSS == SPI_NSS_NONE)
+	for(i = 0u; i < Count; i++)
 	{
-		CLEAR_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
-		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+		total += pVec[i].Size;
 	}
-	//NSS is Mode Fault Input
-	else if(cspi->Init.NSS == SPI_NSS_MFIN)
+	if((total == 0u) || (total > 0xFFFFu))
 	{
-		SET_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
-		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+		return CSL_Error;
 	}
-	//NSS is Chip Select Output
-	else
+	
+	//Skip leading empty Segments
+	while(pVec->Size == 0u)
 	{
-		SET_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
-		SET_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+		pVec++;
+		Count--;
 	}
 	
-	/* configure SPI communication directions */
-	if(cspi->Init.Direction != SPI_DIRECTION_2LINES)
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX) != CSL_OK)
 	{
-		SET_BIT(cspi->Instance->C2, SPI_C2_SPC0_MASK);
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
 	}
 	
-	/* configure Match Value */
-	if(cspi->Init.Match == SPI_MATCH_ENABLE)
+	//Set transcation Information(Rx counts the whole Vector)
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	cspi->pTxBuffer = (uint8_t*)pVec->pData;
+	cspi->pTxXferCount = pVec->Size;
+	cspi->pTxXferSize = (uint16_t)total;
+	cspi->pTxVec = pVec + 1;
+	cspi->TxVecCount = Count - 1u;
+	cspi->pRxBuffer = NULL;
+	cspi->pRxXferCount = (uint16_t)total;
+	cspi->pRxXferSize = (uint16_t)total;
+	
+	//Commucate Directions: 1Line
+	if(cspi->Init.Direction == SPI_DIRECTION_1LINES)
 	{
-		cspi->Instance->M = cspi->Init.MatchValue;
+		__CSL_SPI_1Line_Tx(cspi);
 	}
-	else 
+	
+	SPI_Start_IT(cspi);
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	SPI Transmit through a Symbol Table in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			const uint8_t* TxBuffer
+ *				Data to be encoded
+ *			uint16_t Size
+ *				Size of Data
+ *			const uint8_t* pTable
+ *				Symbol Table, Width Bytes for each of 256 Data Values(placed in Flash)
+ *			uint8_t Width
+ *				Symbol Bytes per Data Byte
+ * @return	CSL_StatusTypeDef
+ * @note	Each Data Byte is sent as pTable[Data * Width] ~ pTable[Data * Width + Width - 1],
+ *			the encoding costs one Table Lookup per Symbol Byte in ISR.
+ *			Size * Width must not be larger than 65535.
+**/
+CSL_StatusTypeDef CSL_SPI_TransmitTable_IT(SPI_HandleTypeDef* cspi, const uint8_t* TxBuffer, uint16_t Size, const uint8_t* pTable, uint8_t Width)
+{
+	uint32_t total = (uint32_t)Size * Width;
+	
+	if((TxBuffer == NULL) || (pTable == NULL) || (total == 0u) || (total > 0xFFFFu))
 	{
-		CLEAR_BIT(cspi->Instance->M, SPI_M_Bits_MASK);
+		return CSL_Error;
 	}
 	
-	/* Pin Configuration */
-	if(cspi->Instance == SPI0)
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX) != CSL_OK)
 	{
-		assert_param(IS_SPI0_PINS(cspi->Init.Pins));
-		SIM->PINSEL &= ~SIM_PINSEL_SPI0PS_MASK;
-		SIM->PINSEL |= cspi->Init.Pins;
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
 	}
-	else
+	
+	//Set transcation Information(counted in Symbol Bytes)
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	cspi->pTxBuffer = (uint8_t*)TxBuffer;
+	cspi->pTxXferCount = (uint16_t)total;
+	cspi->pTxXferSize = (uint16_t)total;
+	cspi->pTxVec = NULL;
+	cspi->TxVecCount = 0u;
+	cspi->pTxTable = pTable;
+	cspi->TxTableWidth = Width;
+	cspi->TxSymbol = 0u;
+	cspi->pRxBuffer = NULL;
+	cspi->pRxXferCount = (uint16_t)total;
+	cspi->pRxXferSize = (uint16_t)total;
+	
+	//Commucate Directions: 1Line
+	if(cspi->Init.Direction == SPI_DIRECTION_1LINES)
 	{
-		assert_param(IS_SPI1_PINS(cspi->Init.Pins));
-		SIM->PINSEL1 &= ~SIM_PINSEL1_SPI1PS_MASK;
-		SIM->PINSEL1 |= cspi->Init.Pins;
+		__CSL_SPI_1Line_Tx(cspi);
 	}
+	
+	SPI_Start_IT(cspi);
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	return CSL_OK;
 }
 
-/** 
- * @brief 	Wait for SPI flags until Timeout
+/**
+ * @brief	Submit a Transaction to SPI Queue(no-blocking, Master only)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			SPI_TransferTypeDef* pXfer
+ *				Transaction Descriptor, must stay valid until its Callback
+ * @return	CSL_StatusTypeDef
+ *				CSL_Busy if Queue is full
+ * @note	Transactions are started in SPIx_IRQHandler() one after another,
+ *			the next one is set up in the ISR ending the previous one.
+ *			Device Settings are written only when the Device changes.
+ *			SPIx IRQ must be enabled in NVIC, the Queue is kicked by pending it.
+ *			Settings of the last Device stay in SPIx->C1 & SPIx->BR afterwards.
+ *			Thread context and Completion Callbacks(ISR) may both submit, the Slot
+ *			is claimed with Interrupts masked.
+ *			CSL_Error is returned after Mode Fault until CSL_SPI_Init() is called again.
 **/
-static CSL_StatusTypeDef SPI_WaitFlag(SPI_HandleTypeDef* cspi, uint8_t Flag, Flag_Status Status, uint32_t TickStart, uint32_t Timeout)
+CSL_StatusTypeDef CSL_SPI_Submit(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer)
 {
+	uint32_t primask = 0u;
+	uint8_t head = 0u;
+	
+	if((cspi == NULL) || (pXfer == NULL) || (pXfer->pDevice == NULL) || \
+	   ((pXfer->CmdSize + pXfer->Size) == 0u) || (cspi->Init.Mode != SPI_MODE_MASTER))
+	{
+		return CSL_Error;
+	}
+	
+	assert_param(IS_SPI_QUEUE_DEPTH(SPI_QUEUE_DEPTH));
+	
+	//an ISR submitting between Slot Write & Head Bump would take the same Slot
+	primask = __get_PRIMASK();
+	__CSL_GIRQ_DISABLE();
+	
+	//Mode Fault, Queue is flushed & closed
+	if(cspi->gState == CSL_SPI_STATE_ERROR)
+	{
+		__set_PRIMASK(primask);
+		return CSL_Error;
+	}
+	
+	//Queue is full
+	if(SPI_QUEUE_COUNT(cspi) >= SPI_QUEUE_DEPTH)
+	{
+		__set_PRIMASK(primask);
+		return CSL_Busy;
+	}
+	
+	pXfer->Status = CSL_Busy;
+	head = cspi->QHead;
+	cspi->pQueue[head & SPI_QUEUE_MASK] = pXfer;
+	
+	//Descriptor must be stored before Head released to ISR
+	__DMB();
+	cspi->QHead = head + 1u;
+	
+	__set_PRIMASK(primask);
+	
+	//Kick the Queue in ISR context
+	NVIC_SetPendingIRQ(SPI_GET_IRQn(cspi));
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Cancel a Transaction submitted to SPI Queue
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			SPI_TransferTypeDef* pXfer
+ *				Transaction Descriptor
+ * @return	CSL_StatusTypeDef
+ *				CSL_Error if pXfer is not in Queue(already completed)
+ * @note	A Transaction in progress is aborted on the Bus. Status of pXfer becomes
+ *			CSL_Error and its Callback is not called, the Descriptor may be reused at once.
+**/
+CSL_StatusTypeDef CSL_SPI_Cancel(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer)
+{
+	uint32_t primask = 0u;
+	uint8_t i = 0u;
+	
+	if((cspi == NULL) || (pXfer == NULL))
+	{
+		return CSL_Error;
+	}
+	
+	//ISR may start, end or submit Transactions meanwhile
+	primask = __get_PRIMASK();
+	__CSL_GIRQ_DISABLE();
+	
+	for(i = cspi->QTail; i != cspi->QHead; i++)
+	{
+		if(cspi->pQueue[i & SPI_QUEUE_MASK] == pXfer)
+		{
+			break;
+		}
+	}
+	if(i == cspi->QHead)
+	{
+		__set_PRIMASK(primask);
+		return CSL_Error;
+	}
+	
+	//Transaction in progress is at Queue Tail
+	if(pXfer == cspi->pXfer)
+	{
+		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SPIE_MASK | SPI_C1_SPTIE_MASK);
+		if(pXfer->pDevice->CS_Port != NULL)
+		{
+			pXfer->pDevice->CS_Port->PSOR = pXfer->pDevice->CS_Pin;
+		}
+		cspi->pXfer = NULL;
+		cspi->RxSkip = 0u;
+		cspi->QTail++;
+		cspi->gState = CSL_SPI_STATE_READY;
+		SPI_Queue_Kick(cspi);
+	}
+	//Close the Gap, later Transactions keep their Order
+	else
+	{
+		for(; (uint8_t)(i + 1u) != cspi->QHead; i++)
+		{
+			cspi->pQueue[i & SPI_QUEUE_MASK] = cspi->pQueue[(i + 1u) & SPI_QUEUE_MASK];
+		}
+		cspi->QHead--;
+	}
+	pXfer->Status = CSL_Error;
+	
+	__set_PRIMASK(primask);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Get Transactions pending in SPI Queue(including the one in progress)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ * @return	Count of Transactions
+ * @note	None
+**/
+uint8_t CSL_SPI_GetQueueCount(SPI_HandleTypeDef* cspi)
+{
+	return SPI_QUEUE_COUNT(cspi);
+}
+
+/**
+ * @brief	Start SPI Slave Streaming in IT(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle(Slave, Match enabled)
+ *			uint8_t* RingBuffer
+ *				Receive Ring Buffer
+ *			uint16_t Size
+ *				Size of Ring Buffer(Power of 2, 2 ~ 32768)
+ *			uint8_t IdleByte
+ *				Byte sent when no Response is available
+ * @return	CSL_StatusTypeDef
+ * @note	Every received Byte goes into the Ring. A Byte equal to cspi->Init.MatchValue
+ *			starts a Frame: the staged Response Bank becomes active and
+ *			CSL_SPI_MatchCallback() is called. The Byte after the Match Byte is already
+ *			in Tx Buffer, so the Response is on MISO from the second Byte after it.
+ *			Call CSL_SPI_SlaveStop() to stop.
+**/
+CSL_StatusTypeDef CSL_SPI_SlaveStart_IT(SPI_HandleTypeDef* cspi, uint8_t* RingBuffer, uint16_t Size, uint8_t IdleByte)
+{
+	if((cspi == NULL) || (RingBuffer == NULL) || !IS_SPI_RingSize(Size) || \
+	   (cspi->Init.Mode != SPI_MODE_SLAVE) || (cspi->Init.Match != SPI_MATCH_ENABLE))
+	{
+		return CSL_Error;
+	}
+	
+	//Process Lock
+	__CSL_LOCK(cspi);
+	
+	if(SPI_Claim(cspi, CSL_SPI_STATE_BUSY_TX_RX) != CSL_OK)
+	{
+		__CSL_UNLOCK(cspi);
+		return CSL_Busy;
+	}
+	
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	cspi->TxISR = SPI_SlaveTxISR;
+	cspi->RxISR = SPI_SlaveRxISR;
+	
+	//Reset Ring & Banks
+	cspi->Slave.pRing = RingBuffer;
+	cspi->Slave.Mask = Size - 1u;
+	cspi->Slave.Head = 0u;
+	cspi->Slave.Tail = 0u;
+	cspi->Slave.Overflow = 0u;
+	cspi->Slave.TxSize[0] = 0u;
+	cspi->Slave.TxSize[1] = 0u;
+	cspi->Slave.Active = 0u;
+	cspi->Slave.Staged = RESET;
+	cspi->Slave.TxIndex = 0u;
+	cspi->Slave.Underrun = 0u;
+	cspi->Slave.IdleByte = IdleByte;
+	
+	//Check SPI is enabled or not
+	if((cspi->Instance->C1 & SPI_C1_SPE_MASK) == 0x00u)
+	{
+		__CSL_SPI_ENABLE(cspi);
+	}
+	
+	//Flush stale Data & Match Flag
+	if(__CSL_SPI_GET_FLAG(cspi, SPI_S_SPRF_MASK))
+	{
+		__CSL_SPI_FLUSH_DR(cspi);
+	}
+	*((__IO uint8_t*)&cspi->Instance->S) = SPI_S_SPMF_MASK;
+	
+	//Process Unlock
+	__CSL_UNLOCK(cspi);
+	
+	//Slave always keeps Tx Buffer filled
+	SET_BIT(cspi->Instance->C1, SPI_C1_SPIE_MASK | SPI_C1_SPTIE_MASK);
+	__CSL_SPI_SPMIE_ENABLE(cspi);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop SPI Slave Streaming
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ * @return	CSL_StatusTypeDef
+ * @note	Data left in Ring is discarded.
+**/
+CSL_StatusTypeDef CSL_SPI_SlaveStop(SPI_HandleTypeDef* cspi)
+{
+	if((cspi == NULL) || (cspi->Slave.pRing == NULL))
+	{
+		return CSL_Error;
+	}
+	
+	//Disable Interrupts
+	CLEAR_BIT(cspi->Instance->C1, SPI_C1_SPIE_MASK | SPI_C1_SPTIE_MASK);
+	__CSL_SPI_SPMIE_DISBALE(cspi);
+	
+	cspi->Slave.pRing = NULL;
+	cspi->Slave.Staged = RESET;
+	cspi->gState = CSL_SPI_STATE_READY;
+	SPI_Queue_Kick(cspi);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stage the Response of next Frame(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			const uint8_t* pData
+ *				Response, must stay valid until the Frame after next one starts
+ *			uint16_t Size
+ *				Size of Response
+ * @return	CSL_StatusTypeDef
+ *				CSL_Busy if the previous Response is still staged
+ * @note	The Bank not being served is written here and taken by ISR at next Match,
+ *			so the Response is ready before the Host clocks it.
+**/
+CSL_StatusTypeDef CSL_SPI_SlaveStage(SPI_HandleTypeDef* cspi, const uint8_t* pData, uint16_t Size)
+{
+	uint8_t bank = 0u;
+	
+	if((cspi == NULL) || (pData == NULL) || (Size == 0u) || (cspi->Slave.pRing == NULL))
+	{
+		return CSL_Error;
+	}
+	
+	//ISR owns the Banks until it takes the staged one
+	if(cspi->Slave.Staged == SET)
+	{
+		return CSL_Busy;
+	}
+	
+	bank = cspi->Slave.Active ^ 1u;
+	cspi->Slave.pTx[bank] = pData;
+	cspi->Slave.TxSize[bank] = Size;
+	
+	//Bank must be written before released to ISR
+	__DMB();
+	cspi->Slave.Staged = SET;
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Read Data out of Slave Receive Ring(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ *			uint8_t* pData
+ *				Destination Buffer
+ *			uint16_t Size
+ *				Max Bytes to read
+ * @return	Bytes actually read, 0 if Ring is empty
+ * @note	Only one context(Consumer) should read the Ring
+**/
+uint16_t CSL_SPI_SlaveRead(SPI_HandleTypeDef* cspi, uint8_t* pData, uint16_t Size)
+{
+	uint16_t tail = cspi->Slave.Tail;
+	uint16_t count = (uint16_t)(cspi->Slave.Head - tail);
+	uint16_t i = 0u;
+	
+	if(count > Size)
+	{
+		count = Size;
+	}
+	
+	//Head must be read before Data
+	__DMB();
+	for(i = 0u; i < count; i++)
+	{
+		pData[i] = cspi->Slave.pRing[(tail + i) & cspi->Slave.Mask];
+	}
+	cspi->Slave.Tail = tail + count;
+	
+	return count;
+}
+
+/**
+ * @brief	Get Frames started before a Response was staged
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ * @return	Underrun Count
+ * @note	None
+**/
+uint32_t CSL_SPI_GetSlaveUnderrun(SPI_HandleTypeDef* cspi)
+{
+	return cspi->Slave.Underrun;
+}
+
+/**
+ * @brief	Get Bytes dropped by full Slave Receive Ring
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ * @return	Overflow Count
+ * @note	None
+**/
+uint32_t CSL_SPI_GetSlaveOverflow(SPI_HandleTypeDef* cspi)
+{
+	return cspi->Slave.Overflow;
+}
+
+/**
+ * @brief	CSL SPI IRQHandler(called by SPIx_IRQHandler())
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle
+ * @return	None
+ * @note	None
+**/
+void CSL_SPI_IRQHandler(SPI_HandleTypeDef* cspi)
+{
+	uint8_t s_flag = cspi->Instance->S;
+	uint8_t c1 = cspi->Instance->C1;
+	
+	//Kicked by CSL_SPI_Submit(), start the Queue(Thread claims gState with Interrupts masked)
+	if((cspi->pXfer == NULL) && (cspi->gState == CSL_SPI_STATE_READY) && (SPI_QUEUE_COUNT(cspi) > 0u))
+	{
+		SPI_Queue_Start(cspi);
+		return;
+	}
+	
+	//Mode Fault: Transfer is aborted(reading S & writing C1 clears MODF)
+	if(((c1 & SPI_C1_SPIE_MASK) != RESET) && ((s_flag & SPI_S_MODF_MASK) != RESET))
+	{
+		//Hardware has cleared MSTR to leave the Bus to the other Master, it stays
+		//cleared and SPI is out of service until CSL_SPI_Init() is called again
+		cspi->Instance->C1 = c1 & ~(SPI_C1_SPIE_MASK | SPI_C1_SPTIE_MASK | SPI_C1_MSTR_MASK);
+		cspi->ErrorCode = CSL_SPI_ERROR_MODF;
+		cspi->gState = CSL_SPI_STATE_ERROR;
+		cspi->pTxTable = NULL;
+		
+		//Every queued Transaction fails, none is started
+		SPI_Queue_Flush(cspi);
+		CSL_SPI_MODFCallback(cspi);
+		return;
+	}
+	
+	//Match(reading S & writing 1 to SPMF clears it)
+	if(((cspi->Instance->C2 & SPI_C2_SPMIE_MASK) != RESET) && ((s_flag & SPI_S_SPMF_MASK) != RESET))
+	{
+		*((__IO uint8_t*)&cspi->Instance->S) = SPI_S_SPMF_MASK;
+		
+		//Frame Start of Slave Streaming
+		if(cspi->Slave.pRing != NULL)
+		{
+			SPI_SlaveFrame(cspi);
+		}
+		CSL_SPI_MatchCallback(cspi);
+	}
+	
+	//Receive Buffer full
+	if(((c1 & SPI_C1_SPIE_MASK) != RESET) && ((s_flag & SPI_S_SPRF_MASK) != RESET))
+	{
+		cspi->RxISR(cspi);
+		return;
+	}
+	
+	//Transmit Buffer empty
+	if(((c1 & SPI_C1_SPTIE_MASK) != RESET) && ((s_flag & SPI_S_SPTEF_MASK) != RESET))
+	{
+		cspi->TxISR(cspi);
+	}
+}
+
+/**
+ * @brief	SPI Transmit Complete Callback
+**/
+__weak void CSL_SPI_TxCpltCallback(SPI_HandleTypeDef* cspi)
+{
+	UNUSED(cspi);
+}
+
+/**
+ * @brief	SPI Receive Complete Callback
+**/
+__weak void CSL_SPI_RxCpltCallback(SPI_HandleTypeDef* cspi)
+{
+	UNUSED(cspi);
+}
+
+/**
+ * @brief	SPI Transmit & Receive Complete Callback
+**/
+__weak void CSL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* cspi)
+{
+	UNUSED(cspi);
+}
+
+/**
+ * @brief	SPI Mode Fault Callback
+**/
+__weak void CSL_SPI_MODFCallback(SPI_HandleTypeDef* cspi)
+{
+	UNUSED(cspi);
+}
+
+/**
+ * @brief	SPI Match Callback
+**/
+__weak void CSL_SPI_MatchCallback(SPI_HandleTypeDef* cspi)
+{
+	UNUSED(cspi);
+}
+
+/**
+ * @brief 	Get SPI current Status
+ * @param
+ * @return 
+ * @note
+**/
+SPI_StateTypeDef CSL_SPI_GetState(SPI_HandleTypeDef* cspi)
+{
+	return cspi->gState;
+}
+
+/**
+ * @brief	Get SPI Error Code
+ * @param
+ * @return 
+ * @note
+**/
+uint8_t CSL_SPI_GetError(SPI_HandleTypeDef* cspi)
+{
+	return cspi->ErrorCode;
+}
+
+/**
+ * @brief 	Get SPI BaudRate in bps(bits/s)
+ * @param
+ * @return 
+ * @note
+**/
+uint32_t CSL_SPI_GetBaudRate(SPI_HandleTypeDef* cspi)
+{
+	uint16_t psc = 0, sc = 0;
+	
+	psc = (cspi->Init.PreScaler) >> SPI_BR_SPPR_SHIFT;
+	sc = 1 << (cspi->Init.Scaler + 1u);
+	return (uint32_t)(SystemBusClock / (psc+1) / sc);
+}
+
+/**
+ * @brief	Solve SPI BaudRate Dividers for a Target SCK Frequency
+ * @param	uint32_t BusClock
+ *				Bus Clock in Hz
+ *			uint32_t BaudRate
+ *				Target SCK in Hz
+ *			uint8_t* PreScaler, uint8_t* Scaler
+ *				Solved Dividers(SPI_BUADRATEPRESCALER_DIVx, SPI_BUADRATESCALER_DIVx)
+ * @return	Actual SCK in Hz, 0 if Target is below the slowest SCK(Dividers untouched)
+ * @note	SCK = BusClock / (SPPR + 1) / 2^(SPR + 1), the fastest SCK not above Target
+ *			is searched, with the smaller PreScaler on a tie.
+**/
+uint32_t CSL_SPI_CalcBaudRate(uint32_t BusClock, uint32_t BaudRate, uint8_t* PreScaler, uint8_t* Scaler)
+{
+	uint32_t need = 0u, best = 0u, div = 0u;
+	uint8_t psc = 0u, sc = 0u;
+	
+	if(BaudRate == 0u)
+	{
+		return 0u;
+	}
+	
+	//Smallest Divider keeping SCK not above Target
+	need = BusClock / BaudRate + ((BusClock % BaudRate) ? 1u : 0u);
+	
+	for(psc = 1u; psc <= 8u; psc++)
+	{
+		//Smallest Scaler for this PreScaler
+		for(sc = 0u; sc <= 8u; sc++)
+		{
+			div = (uint32_t)psc << (sc + 1u);
+			if(div >= need)
+			{
+				break;
+			}
+		}
+		if((sc <= 8u) && ((best == 0u) || (BusClock / div > best)))
+		{
+			best = BusClock / div;
+			*PreScaler = (uint8_t)((psc - 1u) << SPI_BR_SPPR_SHIFT);
+			*Scaler = sc;
+		}
+	}
+	
+	return best;
+}
+
+/**
+ * @brief 	Get SPI match value
+ * @param
+ * @return 
+ * @note
+**/
+uint8_t CSL_SPI_GetMatchValue(SPI_HandleTypeDef* cspi)
+{
+	return cspi->Instance->M;
+}
+
+/**
+ * @brief	Set SPI Match Value
+ * @param
+ * @return 
+ * @note
+**/
+void CSL_SPI_SetMatchValue(SPI_HandleTypeDef* cspi, uint8_t match)
+{
+	if(cspi->Init.Match == SPI_MATCH_ENABLE)
+	{
+		cspi->Init.MatchValue = match;
+		cspi->Instance->M = match;
+	}
+	else return;
+}
+
+/* Private Functions Definations of SPI */
+/**
+ * @brief 	Configure SPI
+**/
+static void SPI_Config(SPI_HandleTypeDef* cspi)
+{
+	/* write SPIx->C1 */
+	cspi->Instance->C1 = cspi->Init.Mode | cspi->Init.CLKPolarity | cspi->Init.CLKPhase | cspi->Init.FirstBit;
+	
+	/* write SPIx->BR */
+	cspi->Instance->BR = cspi->Init.PreScaler | cspi->Init.Scaler;
+	
+	/* configure NSS pin */
+	//no NSS(SS pin is GPIO)
+	if(cspi->Init.NSS == SPI_NSS_NONE)
+	{
+		CLEAR_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
+		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+	}
+	//NSS is Mode Fault Input
+	else if(cspi->Init.NSS == SPI_NSS_MFIN)
+	{
+		SET_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
+		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+	}
+	//NSS is Chip Select Output
+	else
+	{
+		SET_BIT(cspi->Instance->C2, SPI_C2_MODFEN_MASK);
+		SET_BIT(cspi->Instance->C1, SPI_C1_SSOE_MASK);
+	}
+	
+	/* configure SPI communication directions */
+	if(cspi->Init.Direction != SPI_DIRECTION_2LINES)
+	{
+		SET_BIT(cspi->Instance->C2, SPI_C2_SPC0_MASK);
+	}
+	
+	/* configure Match Value */
+	if(cspi->Init.Match == SPI_MATCH_ENABLE)
+	{
+		cspi->Instance->M = cspi->Init.MatchValue;
+	}
+	else 
+	{
+		CLEAR_BIT(cspi->Instance->M, SPI_M_Bits_MASK);
+	}
+	
+	/* Pin Configuration */
+	if(cspi->Instance == SPI0)
+	{
+		assert_param(IS_SPI0_PINS(cspi->Init.Pins));
+		SIM->PINSEL &= ~SIM_PINSEL_SPI0PS_MASK;
+		SIM->PINSEL |= cspi->Init.Pins;
+	}
+	else
+	{
+		assert_param(IS_SPI1_PINS(cspi->Init.Pins));
+		SIM->PINSEL1 &= ~SIM_PINSEL1_SPI1PS_MASK;
+		SIM->PINSEL1 |= cspi->Init.Pins;
+	}
+}
+
+/**
+ * @brief	Start a Transfer in IT
+ * @note	First Byte is written here, each following one is written by SPI_RxISR()
+ *			after SPRF is read. SPI has no Overrun Flag, one Byte in flight keeps a late
+ *			ISR from losing a Byte and leaving the Transfer busy.
+**/
+static void SPI_Start_IT(SPI_HandleTypeDef* cspi)
+{
+	cspi->TxISR = SPI_TxISR;
+	cspi->RxISR = SPI_RxISR;
+	
+	//Queued Transactions use their Device Settings
+	if(cspi->pXfer == NULL)
+	{
+		SPI_UpdateBaudRate(cspi);
+	}
+	
+	//Check SPI is enabled or not
+	if((cspi->Instance->C1 & SPI_C1_SPE_MASK) == 0x00u)
+	{
+		__CSL_SPI_ENABLE(cspi);
+	}
+	
+	//Flush stale Data
+	if(__CSL_SPI_GET_FLAG(cspi, SPI_S_SPRF_MASK))
+	{
+		__CSL_SPI_FLUSH_DR(cspi);
+	}
+	
+	(void)cspi->Instance->S;
+	SPI_TxISR(cspi);
+	SET_BIT(cspi->Instance->C1, SPI_C1_SPIE_MASK);
+}
+
+/**
+ * @brief	Transmit in IT
+ * @note	Called by SPI_RxISR() after each received Byte, SPTIE is only a fallback
+ *			if Tx Buffer is not empty yet. 0xFF is sent if there is no Tx Buffer.
+**/
+static void SPI_TxISR(struct __SPI_HandleTypeDef* cspi)
+{
+	uint8_t data = 0xFFu;
+	
+	//Table Transmit: one Lookup per Symbol Byte
+	if(cspi->pTxTable != NULL)
+	{
+		data = cspi->pTxTable[(uint16_t)(*cspi->pTxBuffer) * cspi->TxTableWidth + cspi->TxSymbol];
+		if(++cspi->TxSymbol == cspi->TxTableWidth)
+		{
+			cspi->TxSymbol = 0u;
+			cspi->pTxBuffer++;
+		}
+	}
+	else if(cspi->pTxBuffer != NULL)
+	{
+		data = *cspi->pTxBuffer++;
+	}
+	*((__IO uint8_t*)&cspi->Instance->D) = data;
+	CLEAR_BIT(cspi->Instance->C1, SPI_C1_SPTIE_MASK);
+	
+	//Walk to next non-empty Segment of Vector
+	if(--cspi->pTxXferCount == 0u)
+	{
+		while(cspi->TxVecCount > 0u)
+		{
+			cspi->TxVecCount--;
+			cspi->pTxBuffer = (uint8_t*)cspi->pTxVec->pData;
+			cspi->pTxXferCount = cspi->pTxVec->Size;
+			cspi->pTxVec++;
+			if(cspi->pTxXferCount != 0u)
+			{
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief	Receive in IT
+**/
+static void SPI_RxISR(struct __SPI_HandleTypeDef* cspi)
+{
+	uint8_t data = *((__IO uint8_t*)&cspi->Instance->D);
+	
+	//Bytes received in Command Phase are discarded
+	if(cspi->RxSkip > 0u)
+	{
+		cspi->RxSkip--;
+	}
+	else if(cspi->pRxBuffer != NULL)
+	{
+		*cspi->pRxBuffer++ = data;
+	}
+	
+	if(--cspi->pRxXferCount == 0u)
+	{
+		SPI_CloseTxRxISR(cspi);
+	}
+	else if(cspi->pTxXferCount > 0u)
+	{
+		//Tx Buffer is empty already once the Byte is received, send the next one
+		if(__CSL_SPI_GET_FLAG(cspi, SPI_S_SPTEF_MASK))
+		{
+			SPI_TxISR(cspi);
+		}
+		else
+		{
+			SET_BIT(cspi->Instance->C1, SPI_C1_SPTIE_MASK);
+		}
+	}
+}
+
+/**
+ * @brief	End Transfer in IT & call back by Transfer Type
+**/
+static void SPI_CloseTxRxISR(struct __SPI_HandleTypeDef* cspi)
+{
+	SPI_StateTypeDef state = cspi->gState;
+	
+	//Disable Interrupts
+	CLEAR_BIT(cspi->Instance->C1, SPI_C1_SPIE_MASK | SPI_C1_SPTIE_MASK);
+	cspi->gState = CSL_SPI_STATE_READY;
+	cspi->pTxTable = NULL;
+	
+	//Queued Transaction is done, chain the next one
+	if(cspi->pXfer != NULL)
+	{
+		SPI_Queue_End(cspi, CSL_OK);
+		return;
+	}
+	
+	if(state == CSL_SPI_STATE_BUSY_TX)
+	{
+		CSL_SPI_TxCpltCallback(cspi);
+	}
+	else if(state == CSL_SPI_STATE_BUSY_RX)
+	{
+		CSL_SPI_RxCpltCallback(cspi);
+	}
+	else
+	{
+		CSL_SPI_TxRxCpltCallback(cspi);
+	}
+	
+	//Transactions submitted during this Transfer
+	if((cspi->gState == CSL_SPI_STATE_READY) && (SPI_QUEUE_COUNT(cspi) > 0u))
+	{
+		SPI_Queue_Start(cspi);
+	}
+}
+
+/**
+ * @brief	Start the Transaction at Queue Tail
+ * @note	Called in ISR only, so Transactions never overlap.
+**/
+static void SPI_Queue_Start(SPI_HandleTypeDef* cspi)
+{
+	SPI_TransferTypeDef* xfer = cspi->pQueue[cspi->QTail & SPI_QUEUE_MASK];
+	const SPI_DeviceTypeDef* dev = xfer->pDevice;
+	uint8_t psc = dev->PreScaler, sc = dev->Scaler;
+	
+	//Bus Clock changed, Device Settings are solved again
+	SPI_UpdateBaudRate(cspi);
+	
+	//Device Settings changed, SPI is disabled while rewriting them
+	if(dev != cspi->pDevice)
+	{
+		if(dev->BaudRate != 0u)
+		{
+			(void)CSL_SPI_CalcBaudRate(cspi->BusClock, dev->BaudRate, &psc, &sc);
+		}
+		CLEAR_BIT(cspi->Instance->C1, SPI_C1_SPE_MASK);
+		MODIFY_REG(cspi->Instance->C1, SPI_C1_CPOL_MASK | SPI_C1_CPHA_MASK, dev->CLKPolarity | dev->CLKPhase);
+		cspi->Instance->BR = psc | sc;
+		cspi->pDevice = dev;
+	}
+	
+	cspi->pXfer = xfer;
+	cspi->gState = CSL_SPI_STATE_BUSY_TX_RX;
+	cspi->ErrorCode = CSL_SPI_ERROR_NONE;
+	
+	//Command Phase is the first Segment, Data Phase follows
+	cspi->XferVec.pData = xfer->pTxData;
+	cspi->XferVec.Size = xfer->Size;
+	if(xfer->CmdSize > 0u)
+	{
+		cspi->pTxBuffer = (uint8_t*)xfer->pCmd;
+		cspi->pTxXferCount = xfer->CmdSize;
+		cspi->pTxVec = &cspi->XferVec;
+		cspi->TxVecCount = (xfer->Size > 0u) ? 1u : 0u;
+	}
+	else
+	{
+		cspi->pTxBuffer = (uint8_t*)xfer->pTxData;
+		cspi->pTxXferCount = xfer->Size;
+		cspi->pTxVec = NULL;
+		cspi->TxVecCount = 0u;
+	}
+	cspi->pTxXferSize = xfer->CmdSize + xfer->Size;
+	cspi->pRxBuffer = xfer->pRxData;
+	cspi->pRxXferCount = cspi->pTxXferSize;
+	cspi->pRxXferSize = cspi->pTxXferSize;
+	cspi->RxSkip = xfer->CmdSize;
+	
+	//Chip Select
+	if(dev->CS_Port != NULL)
+	{
+		dev->CS_Port->PCOR = dev->CS_Pin;
+	}
+	
+	SPI_Start_IT(cspi);
+}
+
+/**
+ * @brief	End the Transaction in progress & start the next one
+**/
+static void SPI_Queue_End(SPI_HandleTypeDef* cspi, CSL_StatusTypeDef Status)
+{
+	SPI_TransferTypeDef* xfer = cspi->pXfer;
+	
+	//Release Chip Select
+	if(xfer->pDevice->CS_Port != NULL)
+	{
+		xfer->pDevice->CS_Port->PSOR = xfer->pDevice->CS_Pin;
+	}
+	
+	//Pop the Transaction
+	cspi->pXfer = NULL;
+	cspi->RxSkip = 0u;
+	cspi->QTail++;
+	
+	//Next Transaction goes on the Bus before Callback
+	if(SPI_QUEUE_COUNT(cspi) > 0u)
+	{
+		SPI_Queue_Start(cspi);
+	}
+	
+	xfer->Status = Status;
+	if(xfer->Callback != NULL)
+	{
+		xfer->Callback(cspi, xfer);
+	}
+}
+
+/**
+ * @brief	Pend SPIx IRQ if Transactions wait in Queue
+ * @note	Called when a Transfer outside the Queue returns to READY,
+ *			the ISR saw Submits during it as busy.
+**/
+static void SPI_Queue_Kick(SPI_HandleTypeDef* cspi)
+{
+	if(SPI_QUEUE_COUNT(cspi) > 0u)
+	{
+		NVIC_SetPendingIRQ(SPI_GET_IRQn(cspi));
+	}
+}
+
+/**
+ * @brief	Fail the Transaction in progress & all of queued ones
+ * @note	Called on Mode Fault, Callbacks can not submit again(gState is ERROR).
+**/
+static void SPI_Queue_Flush(SPI_HandleTypeDef* cspi)
+{
+	SPI_TransferTypeDef* xfer = cspi->pXfer;
+	
+	//Release Chip Select
+	if((xfer != NULL) && (xfer->pDevice->CS_Port != NULL))
+	{
+		xfer->pDevice->CS_Port->PSOR = xfer->pDevice->CS_Pin;
+	}
+	cspi->pXfer = NULL;
+	cspi->RxSkip = 0u;
+	
+	while(SPI_QUEUE_COUNT(cspi) > 0u)
+	{
+		xfer = cspi->pQueue[cspi->QTail & SPI_QUEUE_MASK];
+		cspi->QTail++;
+		
+		xfer->Status = CSL_Error;
+		if(xfer->Callback != NULL)
+		{
+			xfer->Callback(cspi, xfer);
+		}
+	}
+}
+
+/**
+ * @brief	Claim SPI for a Transfer outside the Queue
+ * @note	SPIx ISR starts queued Transactions when gState is READY,
+ *			so gState is tested & set with Interrupts masked.
+**/
+static CSL_StatusTypeDef SPI_Claim(SPI_HandleTypeDef* cspi, SPI_StateTypeDef State)
+{
+	CSL_StatusTypeDef status = CSL_Busy;
+	uint32_t primask = __get_PRIMASK();
+	
+	__CSL_GIRQ_DISABLE();
+	if(cspi->gState == CSL_SPI_STATE_READY)
+	{
+		cspi->gState = State;
+		status = CSL_OK;
+	}
+	__set_PRIMASK(primask);
+	
+	return status;
+}
+
+/**
+ * @brief	Solve BaudRate again if Bus Clock is changed since last time
+ * @note	Queued Devices are written again at next Transaction.
+**/
+static void SPI_UpdateBaudRate(SPI_HandleTypeDef* cspi)
+{
+	if(cspi->BusClock == SystemBusClock)
+	{
+		return;
+	}
+	
+	cspi->BusClock = SystemBusClock;
+	cspi->pDevice = NULL;
+	
+	if((cspi->Init.BaudRate != 0u) && \
+	   (CSL_SPI_CalcBaudRate(SystemBusClock, cspi->Init.BaudRate, &cspi->Init.PreScaler, &cspi->Init.Scaler) != 0u))
+	{
+		cspi->Instance->BR = cspi->Init.PreScaler | cspi->Init.Scaler;
+	}
+}
+
+/**
+ * @brief	Transmit in Slave Streaming(SPTIE stays enabled)
+**/
+static void SPI_SlaveTxISR(struct __SPI_HandleTypeDef* cspi)
+{
+	uint8_t bank = cspi->Slave.Active;
+	uint8_t data = cspi->Slave.IdleByte;
+	
+	if(cspi->Slave.TxIndex < cspi->Slave.TxSize[bank])
+	{
+		data = cspi->Slave.pTx[bank][cspi->Slave.TxIndex++];
+	}
+	*((__IO uint8_t*)&cspi->Instance->D) = data;
+}
+
+/**
+ * @brief	Receive into Ring in Slave Streaming
+**/
+static void SPI_SlaveRxISR(struct __SPI_HandleTypeDef* cspi)
+{
+	uint8_t data = *((__IO uint8_t*)&cspi->Instance->D);
+	uint16_t head = cspi->Slave.Head;
+	
+	//Ring is full, drop the byte
+	if((uint16_t)(head - cspi->Slave.Tail) > cspi->Slave.Mask)
+	{
+		cspi->Slave.Overflow++;
+		return;
+	}
+	
+	cspi->Slave.pRing[head & cspi->Slave.Mask] = data;
+	
+	//Data must be stored before Head released to Consumer
+	__DMB();
+	cspi->Slave.Head = head + 1u;
+}
+
+/**
+ * @brief	Frame Start in Slave Streaming, serve the staged Bank
+**/
+static void SPI_SlaveFrame(SPI_HandleTypeDef* cspi)
+{
+	//Last Response is done, it is not served again
+	cspi->Slave.TxSize[cspi->Slave.Active] = 0u;
+	cspi->Slave.TxIndex = 0u;
+	
+	if(cspi->Slave.Staged == SET)
+	{
+		cspi->Slave.Active ^= 1u;
+		cspi->Slave.Staged = RESET;
+	}
+	else
+	{
+		cspi->Slave.Underrun++;
+	}
+}
+
+/** 
+ * @brief 	Wait for SPI flags until Timeout
+**/
+static CSL_StatusTypeDef SPI_WaitFlag(SPI_HandleTypeDef* cspi, uint8_t Flag, Flag_Status Status, uint32_t TickStart, uint32_t Timeout)
+{
+	uint32_t spin = 0u;
+	
 	while(__CSL_SPI_GET_FLAG(cspi, Flag) != Status)
 	{
-		//Check for Timeout
-		if(Timeout != CSL_MAX_DELAY)
+		//Check for Timeout every SPI_POLL_SPIN Loops
+		if((++spin >= SPI_POLL_SPIN) && (Timeout != CSL_MAX_DELAY))
 		{
+			spin = 0u;
 			if((Timeout == 0u) || (CSL_GetTick() - TickStart > Timeout))
 			{
 				//Disable SPI interrupts
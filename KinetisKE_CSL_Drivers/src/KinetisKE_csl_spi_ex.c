@@ -0,0 +1,628 @@
+/**
+ * Title 	SPI Extra Functions in CSL for KEAZxxx(Source File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+#include "KinetisKE_csl_spi_ex.h"
+
+/** SPI Extra Private Functions Declaration(do not call these in user code) **/
+static void SPIEx_NOR_Prepare(SPI_NOR_HandleTypeDef* cnor, uint8_t Opcode);
+static CSL_StatusTypeDef SPIEx_NOR_Queue(SPI_NOR_HandleTypeDef* cnor);
+static void SPIEx_NOR_XferCplt(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer);
+static void SPIEx_NOR_End(SPI_NOR_HandleTypeDef* cnor, CSL_StatusTypeDef Result);
+
+/** Single Byte Commands **/
+static const uint8_t SPIEx_NOR_CmdWren = SPI_NOR_CMD_WREN;
+static const uint8_t SPIEx_NOR_CmdRdsr = SPI_NOR_CMD_RDSR;
+
+/** Read Chunk Size(Data Phase of one Descriptor) **/
+#define SPIEx_NOR_READ_CHUNK		0x8000u
+
+/** WS2812 Symbols of each Colour Byte(MSB first, in Flash) **/
+static const uint8_t SPIEx_LED_Table[256][SPI_LED_SYMBOL_WIDTH] =
+{
+	{0x92u, 0x49u, 0x24u}, {0x92u, 0x49u, 0x26u}, {0x92u, 0x49u, 0x34u}, {0x92u, 0x49u, 0x36u},	//0x00 ~ 0x03
+	{0x92u, 0x49u, 0xA4u}, {0x92u, 0x49u, 0xA6u}, {0x92u, 0x49u, 0xB4u}, {0x92u, 0x49u, 0xB6u},	//0x04 ~ 0x07
+	{0x92u, 0x4Du, 0x24u}, {0x92u, 0x4Du, 0x26u}, {0x92u, 0x4Du, 0x34u}, {0x92u, 0x4Du, 0x36u},	//0x08 ~ 0x0B
+	{0x92u, 0x4Du, 0xA4u}, {0x92u, 0x4Du, 0xA6u}, {0x92u, 0x4Du, 0xB4u}, {0x92u, 0x4Du, 0xB6u},	//0x0C ~ 0x0F
+	{0x92u, 0x69u, 0x24u}, {0x92u, 0x69u, 0x26u}, {0x92u, 0x69u, 0x34u}, {0x92u, 0x69u, 0x36u},	//0x10 ~ 0x13
+	{0x92u, 0x69u, 0xA4u}, {0x92u, 0x69u, 0xA6u}, {0x92u, 0x69u, 0xB4u}, {0x92u, 0x69u, 0xB6u},	//0x14 ~ 0x17
+	{0x92u, 0x6Du, 0x24u}, {0x92u, 0x6Du, 0x26u}, {0x92u, 0x6Du, 0x34u}, {0x92u, 0x6Du, 0x36u},	//0x18 ~ 0x1B
+	{0x92u, 0x6Du, 0xA4u}, {0x92u, 0x6Du, 0xA6u}, {0x92u, 0x6Du, 0xB4u}, {0x92u, 0x6Du, 0xB6u},	//0x1C ~ 0x1F
+	{0x93u, 0x49u, 0x24u}, {0x93u, 0x49u, 0x26u}, {0x93u, 0x49u, 0x34u}, {0x93u, 0x49u, 0x36u},	//0x20 ~ 0x23
+	{0x93u, 0x49u, 0xA4u}, {0x93u, 0x49u, 0xA6u}, {0x93u, 0x49u, 0xB4u}, {0x93u, 0x49u, 0xB6u},	//0x24 ~ 0x27
+	{0x93u, 0x4Du, 0x24u}, {0x93u, 0x4Du, 0x26u}, {0x93u, 0x4Du, 0x34u}, {0x93u, 0x4Du, 0x36u},	//0x28 ~ 0x2B
+	{0x93u, 0x4Du, 0xA4u}, {0x93u, 0x4Du, 0xA6u}, {0x93u, 0x4Du, 0xB4u}, {0x93u, 0x4Du, 0xB6u},	//0x2C ~ 0x2F
+	{0x93u, 0x69u, 0x24u}, {0x93u, 0x69u, 0x26u}, {0x93u, 0x69u, 0x34u}, {0x93u, 0x69u, 0x36u},	//0x30 ~ 0x33
+	{0x93u, 0x69u, 0xA4u}, {0x93u, 0x69u, 0xA6u}, {0x93u, 0x69u, 0xB4u}, {0x93u, 0x69u, 0xB6u},	//0x34 ~ 0x37
+	{0x93u, 0x6Du, 0x24u}, {0x93u, 0x6Du, 0x26u}, {0x93u, 0x6Du, 0x34u}, {0x93u, 0x6Du, 0x36u},	//0x38 ~ 0x3B
+	{0x93u, 0x6Du, 0xA4u}, {0x93u, 0x6Du, 0xA6u}, {0x93u, 0x6Du, 0xB4u}, {0x93u, 0x6Du, 0xB6u},	//0x3C ~ 0x3F
+	{0x9Au, 0x49u, 0x24u}, {0x9Au, 0x49u, 0x26u}, {0x9Au, 0x49u, 0x34u}, {0x9Au, 0x49u, 0x36u},	//0x40 ~ 0x43
+	{0x9Au, 0x49u, 0xA4u}, {0x9Au, 0x49u, 0xA6u}, {0x9Au, 0x49u, 0xB4u}, {0x9Au, 0x49u, 0xB6u},	//0x44 ~ 0x47
+	{0x9Au, 0x4Du, 0x24u}, {0x9Au, 0x4Du, 0x26u}, {0x9Au, 0x4Du, 0x34u}, {0x9Au, 0x4Du, 0x36u},	//0x48 ~ 0x4B
+	{0x9Au, 0x4Du, 0xA4u}, {0x9Au, 0x4Du, 0xA6u}, {0x9Au, 0x4Du, 0xB4u}, {0x9Au, 0x4Du, 0xB6u},	//0x4C ~ 0x4F
+	{0x9Au, 0x69u, 0x24u}, {0x9Au, 0x69u, 0x26u}, {0x9Au, 0x69u, 0x34u}, {0x9Au, 0x69u, 0x36u},	//0x50 ~ 0x53
+	{0x9Au, 0x69u, 0xA4u}, {0x9Au, 0x69u, 0xA6u}, {0x9Au, 0x69u, 0xB4u}, {0x9Au, 0x69u, 0xB6u},	//0x54 ~ 0x57
+	{0x9Au, 0x6Du, 0x24u}, {0x9Au, 0x6Du, 0x26u}, {0x9Au, 0x6Du, 0x34u}, {0x9Au, 0x6Du, 0x36u},	//0x58 ~ 0x5B
+	{0x9Au, 0x6Du, 0xA4u}, {0x9Au, 0x6Du, 0xA6u}, {0x9Au, 0x6Du, 0xB4u}, {0x9Au, 0x6Du, 0xB6u},	//0x5C ~ 0x5F
+	{0x9Bu, 0x49u, 0x24u}, {0x9Bu, 0x49u, 0x26u}, {0x9Bu, 0x49u, 0x34u}, {0x9Bu, 0x49u, 0x36u},	//0x60 ~ 0x63
+	{0x9Bu, 0x49u, 0xA4u}, {0x9Bu, 0x49u, 0xA6u}, {0x9Bu, 0x49u, 0xB4u}, {0x9Bu, 0x49u, 0xB6u},	//0x64 ~ 0x67
+	{0x9Bu, 0x4Du, 0x24u}, {0x9Bu, 0x4Du, 0x26u}, {0x9Bu, 0x4Du, 0x34u}, {0x9Bu, 0x4Du, 0x36u},	//0x68 ~ 0x6B
+	{0x9Bu, 0x4Du, 0xA4u}, {0x9Bu, 0x4Du, 0xA6u}, {0x9Bu, 0x4Du, 0xB4u}, {0x9Bu, 0x4Du, 0xB6u},	//0x6C ~ 0x6F
+	{0x9Bu, 0x69u, 0x24u}, {0x9Bu, 0x69u, 0x26u}, {0x9Bu, 0x69u, 0x34u}, {0x9Bu, 0x69u, 0x36u},	//0x70 ~ 0x73
+	{0x9Bu, 0x69u, 0xA4u}, {0x9Bu, 0x69u, 0xA6u}, {0x9Bu, 0x69u, 0xB4u}, {0x9Bu, 0x69u, 0xB6u},	//0x74 ~ 0x77
+	{0x9Bu, 0x6Du, 0x24u}, {0x9Bu, 0x6Du, 0x26u}, {0x9Bu, 0x6Du, 0x34u}, {0x9Bu, 0x6Du, 0x36u},	//0x78 ~ 0x7B
+	{0x9Bu, 0x6Du, 0xA4u}, {0x9Bu, 0x6Du, 0xA6u}, {0x9Bu, 0x6Du, 0xB4u}, {0x9Bu, 0x6Du, 0xB6u},	//0x7C ~ 0x7F
+	{0xD2u, 0x49u, 0x24u}, {0xD2u, 0x49u, 0x26u}, {0xD2u, 0x49u, 0x34u}, {0xD2u, 0x49u, 0x36u},	//0x80 ~ 0x83
+	{0xD2u, 0x49u, 0xA4u}, {0xD2u, 0x49u, 0xA6u}, {0xD2u, 0x49u, 0xB4u}, {0xD2u, 0x49u, 0xB6u},	//0x84 ~ 0x87
+	{0xD2u, 0x4Du, 0x24u}, {0xD2u, 0x4Du, 0x26u}, {0xD2u, 0x4Du, 0x34u}, {0xD2u, 0x4Du, 0x36u},	//0x88 ~ 0x8B
+	{0xD2u, 0x4Du, 0xA4u}, {0xD2u, 0x4Du, 0xA6u}, {0xD2u, 0x4Du, 0xB4u}, {0xD2u, 0x4Du, 0xB6u},	//0x8C ~ 0x8F
+	{0xD2u, 0x69u, 0x24u}, {0xD2u, 0x69u, 0x26u}, {0xD2u, 0x69u, 0x34u}, {0xD2u, 0x69u, 0x36u},	//0x90 ~ 0x93
+	{0xD2u, 0x69u, 0xA4u}, {0xD2u, 0x69u, 0xA6u}, {0xD2u, 0x69u, 0xB4u}, {0xD2u, 0x69u, 0xB6u},	//0x94 ~ 0x97
+	{0xD2u, 0x6Du, 0x24u}, {0xD2u, 0x6Du, 0x26u}, {0xD2u, 0x6Du, 0x34u}, {0xD2u, 0x6Du, 0x36u},	//0x98 ~ 0x9B
+	{0xD2u, 0x6Du, 0xA4u}, {0xD2u, 0x6Du, 0xA6u}, {0xD2u, 0x6Du, 0xB4u}, {0xD2u, 0x6Du, 0xB6u},	//0x9C ~ 0x9F
+	{0xD3u, 0x49u, 0x24u}, {0xD3u, 0x49u, 0x26u}, {0xD3u, 0x49u, 0x34u}, {0xD3u, 0x49u, 0x36u},	//0xA0 ~ 0xA3
+	{0xD3u, 0x49u, 0xA4u}, {0xD3u, 0x49u, 0xA6u}, {0xD3u, 0x49u, 0xB4u}, {0xD3u, 0x49u, 0xB6u},	//0xA4 ~ 0xA7
+	{0xD3u, 0x4Du, 0x24u}, {0xD3u, 0x4Du, 0x26u}, {0xD3u, 0x4Du, 0x34u}, {0xD3u, 0x4Du, 0x36u},	//0xA8 ~ 0xAB
+	{0xD3u, 0x4Du, 0xA4u}, {0xD3u, 0x4Du, 0xA6u}, {0xD3u, 0x4Du, 0xB4u}, {0xD3u, 0x4Du, 0xB6u},	//0xAC ~ 0xAF
+	{0xD3u, 0x69u, 0x24u}, {0xD3u, 0x69u, 0x26u}, {0xD3u, 0x69u, 0x34u}, {0xD3u, 0x69u, 0x36u},	//0xB0 ~ 0xB3
+	{0xD3u, 0x69u, 0xA4u}, {0xD3u, 0x69u, 0xA6u}, {0xD3u, 0x69u, 0xB4u}, {0xD3u, 0x69u, 0xB6u},	//0xB4 ~ 0xB7
+	{0xD3u, 0x6Du, 0x24u}, {0xD3u, 0x6Du, 0x26u}, {0xD3u, 0x6Du, 0x34u}, {0xD3u, 0x6Du, 0x36u},	//0xB8 ~ 0xBB
+	{0xD3u, 0x6Du, 0xA4u}, {0xD3u, 0x6Du, 0xA6u}, {0xD3u, 0x6Du, 0xB4u}, {0xD3u, 0x6Du, 0xB6u},	//0xBC ~ 0xBF
+	{0xDAu, 0x49u, 0x24u}, {0xDAu, 0x49u, 0x26u}, {0xDAu, 0x49u, 0x34u}, {0xDAu, 0x49u, 0x36u},	//0xC0 ~ 0xC3
+	{0xDAu, 0x49u, 0xA4u}, {0xDAu, 0x49u, 0xA6u}, {0xDAu, 0x49u, 0xB4u}, {0xDAu, 0x49u, 0xB6u},	//0xC4 ~ 0xC7
+	{0xDAu, 0x4Du, 0x24u}, {0xDAu, 0x4Du, 0x26u}, {0xDAu, 0x4Du, 0x34u}, {0xDAu, 0x4Du, 0x36u},	//0xC8 ~ 0xCB
+	{0xDAu, 0x4Du, 0xA4u}, {0xDAu, 0x4Du, 0xA6u}, {0xDAu, 0x4Du, 0xB4u}, {0xDAu, 0x4Du, 0xB6u},	//0xCC ~ 0xCF
+	{0xDAu, 0x69u, 0x24u}, {0xDAu, 0x69u, 0x26u}, {0xDAu, 0x69u, 0x34u}, {0xDAu, 0x69u, 0x36u},	//0xD0 ~ 0xD3
+	{0xDAu, 0x69u, 0xA4u}, {0xDAu, 0x69u, 0xA6u}, {0xDAu, 0x69u, 0xB4u}, {0xDAu, 0x69u, 0xB6u},	//0xD4 ~ 0xD7
+	{0xDAu, 0x6Du, 0x24u}, {0xDAu, 0x6Du, 0x26u}, {0xDAu, 0x6Du, 0x34u}, {0xDAu, 0x6Du, 0x36u},	//0xD8 ~ 0xDB
+	{0xDAu, 0x6Du, 0xA4u}, {0xDAu, 0x6Du, 0xA6u}, {0xDAu, 0x6Du, 0xB4u}, {0xDAu, 0x6Du, 0xB6u},	//0xDC ~ 0xDF
+	{0xDBu, 0x49u, 0x24u}, {0xDBu, 0x49u, 0x26u}, {0xDBu, 0x49u, 0x34u}, {0xDBu, 0x49u, 0x36u},	//0xE0 ~ 0xE3
+	{0xDBu, 0x49u, 0xA4u}, {0xDBu, 0x49u, 0xA6u}, {0xDBu, 0x49u, 0xB4u}, {0xDBu, 0x49u, 0xB6u},	//0xE4 ~ 0xE7
+	{0xDBu, 0x4Du, 0x24u}, {0xDBu, 0x4Du, 0x26u}, {0xDBu, 0x4Du, 0x34u}, {0xDBu, 0x4Du, 0x36u},	//0xE8 ~ 0xEB
+	{0xDBu, 0x4Du, 0xA4u}, {0xDBu, 0x4Du, 0xA6u}, {0xDBu, 0x4Du, 0xB4u}, {0xDBu, 0x4Du, 0xB6u},	//0xEC ~ 0xEF
+	{0xDBu, 0x69u, 0x24u}, {0xDBu, 0x69u, 0x26u}, {0xDBu, 0x69u, 0x34u}, {0xDBu, 0x69u, 0x36u},	//0xF0 ~ 0xF3
+	{0xDBu, 0x69u, 0xA4u}, {0xDBu, 0x69u, 0xA6u}, {0xDBu, 0x69u, 0xB4u}, {0xDBu, 0x69u, 0xB6u},	//0xF4 ~ 0xF7
+	{0xDBu, 0x6Du, 0x24u}, {0xDBu, 0x6Du, 0x26u}, {0xDBu, 0x6Du, 0x34u}, {0xDBu, 0x6Du, 0x36u},	//0xF8 ~ 0xFB
+	{0xDBu, 0x6Du, 0xA4u}, {0xDBu, 0x6Du, 0xA6u}, {0xDBu, 0x6Du, 0xB4u}, {0xDBu, 0x6Du, 0xB6u},	//0xFC ~ 0xFF
+};
+
+/**
+ * @brief	Probe SPI NOR Flash by JEDEC ID
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle, cnor->cspi & cnor->Device are filled by User
+ *			uint32_t Timeout
+ *				Timeout of ID Reading in ms
+ * @return	CSL_StatusTypeDef
+ * @note	ID is read through SPI Queue, SPIx IRQ must be enabled in NVIC.
+ *			Only 3-Byte Address Flash(up to 16MB) is supported.
+**/
+CSL_StatusTypeDef CSL_SPIEx_NOR_Init(SPI_NOR_HandleTypeDef* cnor, uint32_t Timeout)
+{
+	uint32_t tickstart = 0u;
+	uint8_t cc = 0u;
+
+	if((cnor == NULL) || (cnor->cspi == NULL))
+	{
+		return CSL_Error;
+	}
+
+	//Static Descriptors
+	cnor->XferWren.pDevice = &cnor->Device;
+	cnor->XferWren.pCmd = &SPIEx_NOR_CmdWren;
+	cnor->XferWren.CmdSize = 1u;
+	cnor->XferWren.pTxData = NULL;
+	cnor->XferWren.pRxData = NULL;
+	cnor->XferWren.Size = 0u;
+	cnor->XferWren.Callback = SPIEx_NOR_XferCplt;
+	cnor->XferWren.pContext = cnor;
+
+	cnor->XferPoll.pDevice = &cnor->Device;
+	cnor->XferPoll.pCmd = &SPIEx_NOR_CmdRdsr;
+	cnor->XferPoll.CmdSize = 1u;
+	cnor->XferPoll.pTxData = NULL;
+	cnor->XferPoll.pRxData = &cnor->Status;
+	cnor->XferPoll.Size = 1u;
+	cnor->XferPoll.Callback = SPIEx_NOR_XferCplt;
+	cnor->XferPoll.pContext = cnor;
+
+	cnor->XferPage[0].pDevice = &cnor->Device;
+	cnor->XferPage[0].pContext = cnor;
+	cnor->XferPage[1].pDevice = &cnor->Device;
+	cnor->XferPage[1].pContext = cnor;
+
+	cnor->Operation = SPI_NOR_Op_None;
+	cnor->State = CSL_SPI_NOR_STATE_ERROR;
+
+	//Read JEDEC ID into Cmd[1]
+	cnor->Cmd[0][0] = SPI_NOR_CMD_RDID;
+	cnor->XferPage[0].pCmd = cnor->Cmd[0];
+	cnor->XferPage[0].CmdSize = 1u;
+	cnor->XferPage[0].pTxData = NULL;
+	cnor->XferPage[0].pRxData = cnor->Cmd[1];
+	cnor->XferPage[0].Size = 3u;
+	cnor->XferPage[0].Callback = NULL;
+
+	tickstart = CSL_GetTick();
+	if(CSL_SPI_Submit(cnor->cspi, &cnor->XferPage[0]) != CSL_OK)
+	{
+		return CSL_Busy;
+	}
+	while(cnor->XferPage[0].Status == CSL_Busy)
+	{
+		if((Timeout != CSL_MAX_DELAY) && ((CSL_GetTick() - tickstart) >= Timeout))
+		{
+			//Descriptor must leave the Queue before the Handle is reused, State stays ERROR
+			(void)CSL_SPI_Cancel(cnor->cspi, &cnor->XferPage[0]);
+			return CSL_Timeout;
+		}
+	}
+	if(cnor->XferPage[0].Status != CSL_OK)
+	{
+		return CSL_Error;
+	}
+
+	cnor->JEDEC_ID = ((uint32_t)cnor->Cmd[1][0] << 16u) | ((uint32_t)cnor->Cmd[1][1] << 8u) | cnor->Cmd[1][2];
+	cc = cnor->Cmd[1][2];
+
+	//No Flash on the Bus(MISO floating or stuck)
+	if((cnor->JEDEC_ID == 0x000000u) || (cnor->JEDEC_ID == 0xFFFFFFu))
+	{
+		return CSL_Error;
+	}
+
+	//Capacity Code is log2(Size), 64KB ~ 16MB
+	if((cc < 0x10u) || (cc > 0x18u))
+	{
+		return CSL_Error;
+	}
+	cnor->Capacity = 1ul << cc;
+
+	cnor->State = CSL_SPI_NOR_STATE_READY;
+	cnor->Result = CSL_OK;
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Read SPI NOR Flash(no-blocking)
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ *			uint32_t Address
+ *				Flash Address
+ *			uint8_t* pData
+ *				Destination Buffer
+ *			uint32_t Size
+ *				Bytes to be read
+ * @return	CSL_StatusTypeDef
+ * @note	Fast Read streams into pData in Chunks of 32KB chained by SPI ISR,
+ *			CSL_SPIEx_NOR_CpltCallback() is called when the last Byte is received.
+**/
+CSL_StatusTypeDef CSL_SPIEx_NOR_Read(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, uint8_t* pData, uint32_t Size)
+{
+	if((cnor == NULL) || (pData == NULL) || (Size == 0u) || (Address >= cnor->Capacity) || (Size > cnor->Capacity - Address))
+	{
+		return CSL_Error;
+	}
+
+	if(cnor->State != CSL_SPI_NOR_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+
+	cnor->State = CSL_SPI_NOR_STATE_BUSY;
+	cnor->Operation = SPI_NOR_Op_Read;
+	cnor->Address = Address;
+	cnor->pDst = pData;
+	cnor->Remain = Size;
+	cnor->PageIndex = 0u;
+	cnor->Done = 0u;
+
+	SPIEx_NOR_Prepare(cnor, SPI_NOR_CMD_FAST_READ);
+	if(SPIEx_NOR_Queue(cnor) != CSL_OK)
+	{
+		cnor->State = CSL_SPI_NOR_STATE_READY;
+		cnor->Operation = SPI_NOR_Op_None;
+		return CSL_Busy;
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Program SPI NOR Flash(no-blocking)
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ *			uint32_t Address
+ *				Flash Address(need not be Page aligned)
+ *			const uint8_t* pData
+ *				Data to be programmed
+ *			uint32_t Size
+ *				Bytes to be programmed
+ * @return	CSL_StatusTypeDef
+ * @note	Data is split at Page Boundaries. While a Page is programmed, Status Register
+ *			is polled by the SPI ISR and the next Page is prepared in the other Descriptor,
+ *			so it is queued as soon as WIP is cleared. Other Devices on the same SPI
+ *			share the Bus between Polls. The Area must be erased before.
+**/
+CSL_StatusTypeDef CSL_SPIEx_NOR_Program(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, const uint8_t* pData, uint32_t Size)
+{
+	if((cnor == NULL) || (pData == NULL) || (Size == 0u) || (Address >= cnor->Capacity) || (Size > cnor->Capacity - Address))
+	{
+		return CSL_Error;
+	}
+
+	if(cnor->State != CSL_SPI_NOR_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+
+	cnor->State = CSL_SPI_NOR_STATE_BUSY;
+	cnor->Operation = SPI_NOR_Op_Program;
+	cnor->Address = Address;
+	cnor->pSrc = pData;
+	cnor->Remain = Size;
+	cnor->PageIndex = 0u;
+	cnor->Done = 0u;
+
+	SPIEx_NOR_Prepare(cnor, SPI_NOR_CMD_PP);
+	if(SPIEx_NOR_Queue(cnor) != CSL_OK)
+	{
+		cnor->State = CSL_SPI_NOR_STATE_READY;
+		cnor->Operation = SPI_NOR_Op_None;
+		return CSL_Busy;
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Erase SPI NOR Flash(no-blocking)
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ *			uint32_t Address
+ *				Any Address in the Sector/Block(ignored for Chip Erase)
+ *			uint8_t EraseSize
+ *				SPI_NOR_Erase_Sector/SPI_NOR_Erase_Block/SPI_NOR_Erase_Chip
+ * @return	CSL_StatusTypeDef
+ * @note	Completion is polled in SPI ISR, CSL_SPIEx_NOR_CpltCallback() is called when done.
+**/
+CSL_StatusTypeDef CSL_SPIEx_NOR_Erase(SPI_NOR_HandleTypeDef* cnor, uint32_t Address, uint8_t EraseSize)
+{
+	if((cnor == NULL) || (Address >= cnor->Capacity))
+	{
+		return CSL_Error;
+	}
+
+	assert_param(IS_SPI_NOR_Erase(EraseSize));
+
+	if(cnor->State != CSL_SPI_NOR_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+
+	cnor->State = CSL_SPI_NOR_STATE_BUSY;
+	cnor->Operation = SPI_NOR_Op_Erase;
+	cnor->Address = Address;
+	cnor->Remain = 0u;
+	cnor->PageIndex = 0u;
+	cnor->Done = 0u;
+
+	SPIEx_NOR_Prepare(cnor, EraseSize);
+	if(SPIEx_NOR_Queue(cnor) != CSL_OK)
+	{
+		cnor->State = CSL_SPI_NOR_STATE_READY;
+		cnor->Operation = SPI_NOR_Op_None;
+		return CSL_Busy;
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Get SPI NOR Flash State
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ * @return	SPI_NOR_StateTypeDef
+ * @note	None
+**/
+SPI_NOR_StateTypeDef CSL_SPIEx_NOR_GetState(SPI_NOR_HandleTypeDef* cnor)
+{
+	return cnor->State;
+}
+
+/**
+ * @brief	SPI NOR Operation Complete Callback
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ * @return	None
+ * @note	None
+**/
+__weak void CSL_SPIEx_NOR_CpltCallback(SPI_NOR_HandleTypeDef* cnor)
+{
+	UNUSED(cnor);
+}
+
+/**
+ * @brief	SPI NOR Operation Error Callback
+ * @param	SPI_NOR_HandleTypeDef* cnor
+ *				NOR Handle
+ * @return	None
+ * @note	Operation is aborted, the first cnor->Done Bytes from the Start Address are
+ *			read/programmed. cnor->Address runs ahead of it by the prepared Chunk.
+**/
+__weak void CSL_SPIEx_NOR_ErrorCallback(SPI_NOR_HandleTypeDef* cnor)
+{
+	UNUSED(cnor);
+}
+
+/**
+ * @brief	Initialize SPI for WS2812 LED Strip
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle, Instance & Pins are filled by User
+ * @return	CSL_StatusTypeDef
+ *				CSL_Error if Bus Clock can not give SCK inside WS2812 Tolerance
+ * @note	Only MOSI is connected to DIN of the first LED, SCK & MISO are not used.
+ *			BaudRate is solved again after Bus Clock changes.
+**/
+CSL_StatusTypeDef CSL_SPIEx_LED_Init(SPI_HandleTypeDef* cspi)
+{
+	uint32_t sck = 0u;
+
+	if(cspi == NULL)
+	{
+		return CSL_Error;
+	}
+
+	cspi->Init.Mode = SPI_MODE_MASTER;
+	cspi->Init.Direction = SPI_DIRECTION_2LINES;
+	cspi->Init.CLKPolarity = SPI_POLARITY_HIGH;
+	cspi->Init.CLKPhase = SPI_PHASE_1EDGE;
+	cspi->Init.NSS = SPI_NSS_NONE;
+	cspi->Init.FirstBit = SPI_FIRSTBIT_MSB;
+	cspi->Init.BaudRate = SPI_LED_BAUDRATE;
+	cspi->Init.Match = SPI_MATCH_DISABLE;
+
+	if(CSL_SPI_Init(cspi) != CSL_OK)
+	{
+		return CSL_Error;
+	}
+
+	sck = CSL_SPI_GetBaudRate(cspi);
+	if((sck < SPI_LED_BAUDRATE_MIN) || (sck > SPI_LED_BAUDRATE_MAX))
+	{
+		return CSL_Error;
+	}
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Send Colours to WS2812 LED Strip(no-blocking)
+ * @param	SPI_HandleTypeDef* cspi
+ *				SPI Handle initialized by CSL_SPIEx_LED_Init()
+ *			const uint8_t* pGRB
+ *				Colours in G, R, B order for each LED
+ *			uint16_t Count
+ *				Count of LEDs(up to 7281)
+ * @return	CSL_StatusTypeDef
+ * @note	Colour Bytes are encoded by SPIEx_LED_Table in SPI ISR, Interrupts are not
+ *			disabled. SPIx IRQ should have the highest Priority, a late refill stretches
+ *			the Low Phase of a LED Bit. CSL_SPI_TxCpltCallback() is called after the last
+ *			Bit, the Strip latches after MOSI keeps Low for the Reset Time(>= 280us for
+ *			WS2812B), so call this again after that.
+**/
+CSL_StatusTypeDef CSL_SPIEx_LED_Show(SPI_HandleTypeDef* cspi, const uint8_t* pGRB, uint16_t Count)
+{
+	if((cspi == NULL) || (pGRB == NULL) || (Count == 0u) || (Count > (0xFFFFu / 3u / SPI_LED_SYMBOL_WIDTH)))
+	{
+		return CSL_Error;
+	}
+
+	return CSL_SPI_TransmitTable_IT(cspi, pGRB, Count * 3u, &SPIEx_LED_Table[0][0], SPI_LED_SYMBOL_WIDTH);
+}
+
+/* SPI Extra Private Functions */
+/**
+ * @brief	Build next Chunk in Page Descriptor cnor->PageIndex
+**/
+static void SPIEx_NOR_Prepare(SPI_NOR_HandleTypeDef* cnor, uint8_t Opcode)
+{
+	uint8_t idx = cnor->PageIndex;
+	uint8_t* cmd = cnor->Cmd[idx];
+	SPI_TransferTypeDef* xfer = &cnor->XferPage[idx];
+	uint32_t size = 0u;
+
+	cmd[0] = Opcode;
+	cmd[1] = (uint8_t)(cnor->Address >> 16u);
+	cmd[2] = (uint8_t)(cnor->Address >> 8u);
+	cmd[3] = (uint8_t)(cnor->Address);
+	cmd[4] = 0x00u;
+
+	xfer->pCmd = cmd;
+	xfer->pTxData = NULL;
+	xfer->pRxData = NULL;
+	xfer->Callback = SPIEx_NOR_XferCplt;
+
+	switch(Opcode)
+	{
+	case SPI_NOR_CMD_FAST_READ:
+		size = (cnor->Remain > SPIEx_NOR_READ_CHUNK) ? SPIEx_NOR_READ_CHUNK : cnor->Remain;
+		xfer->CmdSize = 5u;
+		xfer->pRxData = cnor->pDst;
+		cnor->pDst += size;
+		break;
+	case SPI_NOR_CMD_PP:
+		//Page Program wraps inside the Page, stop at Boundary
+		size = SPI_NOR_PAGE_SIZE - (cnor->Address & (SPI_NOR_PAGE_SIZE - 1u));
+		size = (cnor->Remain > size) ? size : cnor->Remain;
+		xfer->CmdSize = 4u;
+		xfer->pTxData = cnor->pSrc;
+		cnor->pSrc += size;
+		break;
+	case SPI_NOR_CMD_CE:
+		xfer->CmdSize = 1u;
+		break;
+	default:
+		xfer->CmdSize = 4u;
+		break;
+	}
+
+	xfer->Size = (uint16_t)size;
+	cnor->Address += size;
+	cnor->Remain -= size;
+	cnor->PageIndex ^= 1u;
+}
+
+/**
+ * @brief	Queue the prepared Page Descriptor(Write Enable first if needed)
+**/
+static CSL_StatusTypeDef SPIEx_NOR_Queue(SPI_NOR_HandleTypeDef* cnor)
+{
+	//Prepared Descriptor is the one before PageIndex
+	SPI_TransferTypeDef* xfer = &cnor->XferPage[cnor->PageIndex ^ 1u];
+	CSL_StatusTypeDef status = CSL_OK;
+	uint32_t primask = 0u;
+
+	//Cleared before Submit, the Page may complete at once in ISR
+	cnor->Prepared = RESET;
+	cnor->pQueued = xfer;
+
+	if(cnor->Operation == SPI_NOR_Op_Read)
+	{
+		return CSL_SPI_Submit(cnor->cspi, xfer);
+	}
+
+	//Write Enable & its Page take 2 Slots together, no stray Write Enable is left if one fails
+	primask = __get_PRIMASK();
+	__CSL_GIRQ_DISABLE();
+
+	if((SPI_QUEUE_DEPTH - CSL_SPI_GetQueueCount(cnor->cspi)) < 2u)
+	{
+		status = CSL_Busy;
+	}
+	else
+	{
+		(void)CSL_SPI_Submit(cnor->cspi, &cnor->XferWren);
+		(void)CSL_SPI_Submit(cnor->cspi, xfer);
+	}
+
+	__set_PRIMASK(primask);
+
+	return status;
+}
+
+/**
+ * @brief	Descriptor Complete Callback(in SPI ISR), runs the Operation
+**/
+static void SPIEx_NOR_XferCplt(SPI_HandleTypeDef* cspi, SPI_TransferTypeDef* pXfer)
+{
+	SPI_NOR_HandleTypeDef* cnor = (SPI_NOR_HandleTypeDef*)pXfer->pContext;
+
+	UNUSED(cspi);
+
+	//Operation is already aborted
+	if(cnor->State != CSL_SPI_NOR_STATE_BUSY)
+	{
+		return;
+	}
+
+	if(pXfer->Status != CSL_OK)
+	{
+		SPIEx_NOR_End(cnor, CSL_Error);
+		return;
+	}
+
+	//Read Chunk is in pData
+	if(cnor->Operation == SPI_NOR_Op_Read)
+	{
+		cnor->Done += pXfer->Size;
+	}
+
+	//Write Enable is followed by its Page in Queue
+	if(pXfer == &cnor->XferWren)
+	{
+		return;
+	}
+
+	//Status Polling
+	if(pXfer == &cnor->XferPoll)
+	{
+		if((cnor->Status & SPI_NOR_SR_WIP) != 0u)
+		{
+			if(CSL_SPI_Submit(cspi, &cnor->XferPoll) != CSL_OK)
+			{
+				SPIEx_NOR_End(cnor, CSL_Error);
+			}
+		}
+		else if(cnor->Prepared == SET)
+		{
+			//Page programmed
+			cnor->Done += cnor->pQueued->Size;
+			if(SPIEx_NOR_Queue(cnor) != CSL_OK)
+			{
+				SPIEx_NOR_End(cnor, CSL_Error);
+			}
+		}
+		else
+		{
+			cnor->Done += cnor->pQueued->Size;
+			SPIEx_NOR_End(cnor, CSL_OK);
+		}
+		return;
+	}
+
+	//Read Chunk is done, chain the next one
+	if(cnor->Operation == SPI_NOR_Op_Read)
+	{
+		if(cnor->Remain == 0u)
+		{
+			SPIEx_NOR_End(cnor, CSL_OK);
+		}
+		else
+		{
+			SPIEx_NOR_Prepare(cnor, SPI_NOR_CMD_FAST_READ);
+			if(SPIEx_NOR_Queue(cnor) != CSL_OK)
+			{
+				SPIEx_NOR_End(cnor, CSL_Error);
+			}
+		}
+		return;
+	}
+
+	//Program/Erase started, poll WIP and prepare next Page meanwhile
+	if(CSL_SPI_Submit(cspi, &cnor->XferPoll) != CSL_OK)
+	{
+		SPIEx_NOR_End(cnor, CSL_Error);
+		return;
+	}
+	if(cnor->Remain > 0u)
+	{
+		SPIEx_NOR_Prepare(cnor, SPI_NOR_CMD_PP);
+		cnor->Prepared = SET;
+	}
+}
+
+/**
+ * @brief	End the Operation & call back
+**/
+static void SPIEx_NOR_End(SPI_NOR_HandleTypeDef* cnor, CSL_StatusTypeDef Result)
+{
+	cnor->Operation = SPI_NOR_Op_None;
+	cnor->Prepared = RESET;
+	cnor->Result = Result;
+	cnor->State = CSL_SPI_NOR_STATE_READY;
+
+	if(Result == CSL_OK)
+	{
+		CSL_SPIEx_NOR_CpltCallback(cnor);
+	}
+	else
+	{
+		CSL_SPIEx_NOR_ErrorCallback(cnor);
+	}
+}
+
+//EOF
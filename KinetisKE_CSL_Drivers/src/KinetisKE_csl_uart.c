@@ -11,9 +11,49 @@
 static void UART_Config(UART_HandleTypeDef* cuart);
 static uint16_t UART_BaudRate_Cal(uint32_t BaudRate);
 static CSL_StatusTypeDef UART_WaitFlag(UART_HandleTypeDef* cuart, uint8_t Flag, Flag_Status Status, uint32_t TickStart, uint32_t Timeout);
-static CSL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef* cuart);
+static void UART_SetISR(UART_HandleTypeDef* cuart);
+static void UART_TxISR_8Bit(UART_HandleTypeDef* cuart);
+static void UART_TxISR_9Bit(UART_HandleTypeDef* cuart);
+static void UART_TxISR_Ring(UART_HandleTypeDef* cuart);
+static Flag_Status UART_NextSegment(UART_HandleTypeDef* cuart);
 static CSL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef* cuart);
-static CSL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef* cuart);
+static void UART_RS485_Start(UART_HandleTypeDef* cuart);
+static Flag_Status UART_RS485_EndPhase(UART_HandleTypeDef* cuart);
+static void UART_RS485_Release(UART_HandleTypeDef* cuart);
+static void UART_RxISR_8Bit(UART_HandleTypeDef* cuart);
+static void UART_RxISR_7Bit(UART_HandleTypeDef* cuart);
+static void UART_RxISR_9Bit(UART_HandleTypeDef* cuart);
+static void UART_RxISR_Ring8Bit(UART_HandleTypeDef* cuart);
+static void UART_RxISR_Ring7Bit(UART_HandleTypeDef* cuart);
+static void UART_RxISR_Address(UART_HandleTypeDef* cuart);
+static void UART_PushRing(UART_RingTypeDef* ring, uint8_t data);
+static void UART_EndReceive_IT(UART_HandleTypeDef* cuart);
+static void UART_EndFrame_IT(UART_HandleTypeDef* cuart);
+static void UART_IRQHandler(UART_HandleTypeDef* cuart);
+
+/** UART Private Macros **/
+#define UART_IS_9BIT_DATA(__HANDLE__)	(((__HANDLE__)->Init.WordLength == UART_Word_9B) && ((__HANDLE__)->Init.Parity == UART_Parity_None))
+#define UART_IS_FRAME_MODE(__HANDLE__)	(((__HANDLE__)->RxMode == UART_RxMode_Idle) || ((__HANDLE__)->RxMode == UART_RxMode_Address))
+//Receiver sleeps until next Address Mark(cleared by Hardware)
+#define UART_RX_MUTE(__HANDLE__)		(SET_BIT((__HANDLE__)->Instance->C2, UART_C2_RWU_MASK))
+#define UART_IS_7BIT_DATA(__HANDLE__)	(((__HANDLE__)->Init.WordLength == UART_Word_8B) && ((__HANDLE__)->Init.Parity != UART_Parity_None))
+#define UART_RS485_ENABLED(__HANDLE__)	((__HANDLE__)->RS485.DE_Port != NULL)
+#define UART_RS485_DE_ASSERT(__HANDLE__)	(((__HANDLE__)->RS485.DE_Polarity == UART_RS485_DE_High) ? \
+										 ((__HANDLE__)->RS485.DE_Port->PSOR = (__HANDLE__)->RS485.DE_Pin) : \
+										 ((__HANDLE__)->RS485.DE_Port->PCOR = (__HANDLE__)->RS485.DE_Pin))
+#define UART_RS485_DE_RELEASE(__HANDLE__)	(((__HANDLE__)->RS485.DE_Polarity == UART_RS485_DE_High) ? \
+										 ((__HANDLE__)->RS485.DE_Port->PCOR = (__HANDLE__)->RS485.DE_Pin) : \
+										 ((__HANDLE__)->RS485.DE_Port->PSOR = (__HANDLE__)->RS485.DE_Pin))
+//Toggling TE queues one Idle Character, TC is set when it is sent
+#define UART_QUEUE_IDLE(__HANDLE__)		do{CLEAR_BIT((__HANDLE__)->Instance->C2, UART_C2_TE_MASK); \
+										   SET_BIT((__HANDLE__)->Instance->C2, UART_C2_TE_MASK);}while(0U)
+#if (UART_STATISTICS_STAT == 0x01u)
+ #define UART_STATS_INC(__HANDLE__, __FIELD__)			((__HANDLE__)->Stats.__FIELD__++)
+ #define UART_STATS_ADD(__HANDLE__, __FIELD__, __N__)	((__HANDLE__)->Stats.__FIELD__ += (__N__))
+#else
+ #define UART_STATS_INC(__HANDLE__, __FIELD__)			((void)0U)
+ #define UART_STATS_ADD(__HANDLE__, __FIELD__, __N__)	((void)0U)
+#endif /*UART_STATISTICS_STAT == 0x01u*/
 
 /** UART Public Functions **/
 /**
@@ -169,9 +209,12 @@ ERR:
 
 /**
  * @brief	Configure UART as Multi-Processor Communication
- * @param
- * @return
- * @note
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t WakeUp
+ *				Receiver Wake-up Method, UART_Wakeup_Wire or UART_Wakeup_Address
+ * @return	CSL_StatusTypeDef
+ * @note	Use CSL_UART_ReceiveAddressed_IT() to receive with Address Mark Wake-up.
 **/
 CSL_StatusTypeDef CSL_UART_MultiProcessorInit(UART_HandleTypeDef* cuart, uint8_t WakeUp)
 {
@@ -183,6 +226,7 @@ CSL_StatusTypeDef CSL_UART_MultiProcessorInit(UART_HandleTypeDef* cuart, uint8_t
 	
 	//parameter check
 	assert_param(IS_UART_UARTx(cuart->Instance));
+	assert_param(IS_UART_Wakeup(WakeUp));
 	
 	//User Init(Msp Init)
 	if(cuart->gState == CSL_UART_STATE_RESET)
@@ -196,8 +240,7 @@ CSL_StatusTypeDef CSL_UART_MultiProcessorInit(UART_HandleTypeDef* cuart, uint8_t
 	UART_Config(cuart);
 	
 	//UART Wakeup Methods Configure
-	CLEAR_BIT(cuart->Instance->C1, UART_C1_WAKE_MASK);
-	cuart->Instance->C1 |= UART_C1_WAKE_MASK;
+	MODIFY_REG(cuart->Instance->C1, UART_C1_WAKE_MASK, WakeUp);
 	
 	//Enable UART IDLE Detection
 	__CSL_UART_ENABLE_IDLE(cuart);
@@ -216,6 +259,61 @@ ERR:
 	return CSL_Error;
 }
 
+/**
+ * @brief	Configure UART for a RS-485 Transceiver with a GPIO DE Pin
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle, cuart->RS485 is filled by User
+ * @return	CSL_StatusTypeDef
+ * @note	DE Pin is configured as Output & released here, its Pin Mux is done in CSL_UART_MspInit().
+ *			DE is asserted on the first TDRE Interrupt of IT Transmits and released in the
+ *			TC Interrupt after TailGuard. CSL_UART_Transmit() drives DE without Guard Times.
+**/
+CSL_StatusTypeDef CSL_UART_RS485_Init(UART_HandleTypeDef* cuart)
+{
+	//Error: cuart is NULL or no DE Pin
+	if((cuart == NULL) || (cuart->RS485.DE_Port == NULL) || (cuart->Init.UART_Line != UART_Line_2Line))
+	{
+		goto ERR;
+	}
+	
+	//parameter check
+	assert_param(IS_UART_UARTx(cuart->Instance));
+	assert_param(IS_UART_RS485_DE(cuart->RS485.DE_Polarity));
+	
+	//User Init(Msp Init)
+	if(cuart->gState == CSL_UART_STATE_RESET)
+	{
+		__CSL_UNLOCK(cuart);
+		CSL_UART_MspInit(cuart);
+	}
+	
+	//UART Configure
+	cuart->gState = CSL_UART_STATE_BUSY;
+	UART_Config(cuart);
+	
+	//DE Pin is Output and released
+	UART_RS485_DE_RELEASE(cuart);
+	cuart->RS485.DE_Port->PDDR |= cuart->RS485.DE_Pin;
+	cuart->RS485.Phase = UART_RS485_Phase_Idle;
+	cuart->RS485.GuardCount = 0u;
+	
+	cuart->gState = CSL_UART_STATE_READY;
+	cuart->RxState = CSL_UART_STATE_READY;
+	cuart->ErrorCode = CSL_UART_ERROR_NONE;
+	
+	return CSL_OK;
+	
+	//Error
+ERR:
+	if(cuart != NULL)
+	{
+		cuart->gState = CSL_UART_STATE_ERROR;
+		cuart->RxState = CSL_UART_STATE_RESET;
+		cuart->ErrorCode = CSL_UART_ERROR_CONFIG;
+	}
+	return CSL_Error;
+}
+
 /**
  * @brief	User-defined Initialize UART function
  * @param
@@ -268,49 +366,71 @@ CSL_StatusTypeDef CSL_UART_Transmit(UART_HandleTypeDef* cuart, uint8_t* TxBuffer
 		//Init TickStart for Timeout Management
 		tickstart = CSL_GetTick();
 
-		while(cuart->pTxXferCount > 0u)
+		//RS-485 Driver on
+		if(UART_RS485_ENABLED(cuart))
 		{
-			cuart->pTxXferCount--;
-
-			//Check Timeout
-			if(UART_WaitFlag(cuart, UART_Tx_TDRE, SET, tickstart, Timeout) != CSL_OK)
+			UART_RS485_DE_ASSERT(cuart);
+			cuart->RS485.Phase = UART_RS485_Phase_Data;
+			if(cuart->RS485.RxDisable == ENABLE)
 			{
-				return CSL_Timeout;
+				CLEAR_BIT(cuart->Instance->C2, UART_C2_RE_MASK);
 			}
-			
-			//word length is 9bit
-			if(cuart->Init.WordLength == UART_Word_9B)
+		}
+
+		//9 bit Data, MSB is written to UARTx->C3[T8]
+		if(UART_IS_9BIT_DATA(cuart))
+		{
+			tmp = (uint16_t*)cuart->pTxBuffer;
+			while(cuart->pTxXferCount > 0u)
 			{
-				tmp = (uint16_t*)cuart->pTxBuffer;
-				//Write Data to UARTx->C3[T8] & UARTx->D
-				CLEAR_BIT(cuart->Instance->C3, UART_C3_T8_MASK);
-				cuart->Instance->C3 = ((*tmp >> 1) & 0x80u) | cuart->Instance->C3;
-				cuart->Instance->D = (uint8_t)(*tmp & (uint8_t)0xFF);
-				if(cuart->Init.Parity == UART_Parity_None)
-				{
-					cuart->pTxBuffer += 2u;
-				}
-				else
+				cuart->pTxXferCount--;
+				
+				//Check Timeout
+				if(UART_WaitFlag(cuart, UART_Tx_TDRE, SET, tickstart, Timeout) != CSL_OK)
 				{
-					cuart->pTxBuffer += 1u;
+					UART_RS485_Release(cuart);
+					__CSL_UNLOCK(cuart);
+					return CSL_Timeout;
 				}
+				
+				MODIFY_REG(cuart->Instance->C3, UART_C3_T8_MASK, (*tmp >> 2u) & UART_C3_T8_MASK);
+				cuart->Instance->D = (uint8_t)*tmp++;
 			}
-			//word length is 8bit
-			else 
+		}
+		//8 bit & 7 bit Data
+		else
+		{
+			while(cuart->pTxXferCount > 0u)
 			{
-				cuart->Instance->D = (uint8_t)(*cuart->pTxBuffer++ & (uint8_t)0xFF);
+				cuart->pTxXferCount--;
+				
+				//Check Timeout
+				if(UART_WaitFlag(cuart, UART_Tx_TDRE, SET, tickstart, Timeout) != CSL_OK)
+				{
+					UART_RS485_Release(cuart);
+					__CSL_UNLOCK(cuart);
+					return CSL_Timeout;
+				}
+				
+				cuart->Instance->D = *cuart->pTxBuffer++;
 			}
 		}
 
 		//Wait Transmit Complete
 		if(UART_WaitFlag(cuart, UART_Tx_TC, SET, tickstart, Timeout) != CSL_OK)
 		{
+			UART_RS485_Release(cuart);
+			__CSL_UNLOCK(cuart);
 			return CSL_Timeout;
 		}
+		
+		//RS-485 Driver off
+		UART_RS485_Release(cuart);
 
 		//Process unlock
 		__CSL_UNLOCK(cuart);
 
+		UART_STATS_ADD(cuart, TxBytes, Size);
 		cuart->gState = CSL_UART_STATE_READY;
 
 		return CSL_OK;
@@ -341,7 +461,8 @@ CSL_StatusTypeDef CSL_UART_Receive(UART_HandleTypeDef* cuart, uint8_t* RxBuffer,
 
 	uint32_t tickstart = 0;
 	uint16_t* tmp = 0;
-	uint8_t data = 0;
+	uint16_t data = 0;
+	uint8_t mask = 0xFFu;
 
 	if(cuart->RxState == CSL_UART_STATE_READY)
 	{
@@ -357,52 +478,51 @@ CSL_StatusTypeDef CSL_UART_Receive(UART_HandleTypeDef* cuart, uint8_t* RxBuffer,
 		//Init TickStart for Timeout Management
 		tickstart = CSL_GetTick();
 
-		while(cuart->pRxXferCount > 0u)
+		//9 bit Data, MSB is read from UARTx->C3[R8]
+		if(UART_IS_9BIT_DATA(cuart))
 		{
-			cuart->pRxXferCount--;
-
-			//Clear RDRF Flag
-			__CSL_UART_FLUSH_S1(cuart);
-
-			//Check Timeout
-			if(UART_WaitFlag(cuart, UART_Rx_RDRF, SET, tickstart, Timeout) != CSL_OK)
-			{
-				return CSL_Timeout;
-			}
-
-			//Word length is 9 bit
-			if(cuart->Init.WordLength == UART_Word_9B)
+			tmp = (uint16_t*)RxBuffer;
+			while(cuart->pRxXferCount > 0u)
 			{
-				tmp = (uint16_t*)RxBuffer;
-				data = cuart->Instance->D;
-				if(cuart->Init.Parity == UART_Parity_None)
-				{
-					*tmp = (uint16_t)(((cuart->Instance->C3 & 0x80u << 1u) | data) & 0x01FFu);
-					RxBuffer += 2u;
-				}
-				else
+				cuart->pRxXferCount--;
+				
+				//Check Timeout
+				if(UART_WaitFlag(cuart, UART_Rx_RDRF, SET, tickstart, Timeout) != CSL_OK)
 				{
-					*tmp = (uint16_t)(cuart->Instance->D & 0x00FFu);
-					RxBuffer += 1u;
+					__CSL_UNLOCK(cuart);
+					return CSL_Timeout;
 				}
+				
+				data = (uint16_t)(cuart->Instance->C3 & UART_C3_R8_MASK) << 1u;
+				*tmp++ = data | cuart->Instance->D;
+			}
+		}
+		//8 bit & 7 bit Data(Parity Bit removed)
+		else
+		{
+			if(UART_IS_7BIT_DATA(cuart))
+			{
+				mask = 0x7Fu;
 			}
-			//Word length is 8 bit
-			else
+			while(cuart->pRxXferCount > 0u)
 			{
-				if(cuart->Init.Parity == UART_Parity_None)
-				{
-					*RxBuffer++ = (uint8_t)(cuart->Instance->D & 0x00FFu);
-				}
-				else
+				cuart->pRxXferCount--;
+				
+				//Check Timeout
+				if(UART_WaitFlag(cuart, UART_Rx_RDRF, SET, tickstart, Timeout) != CSL_OK)
 				{
-					*RxBuffer++ = (uint8_t)(cuart->Instance->D & 0x007Fu);
+					__CSL_UNLOCK(cuart);
+					return CSL_Timeout;
 				}
+				
+				*RxBuffer++ = cuart->Instance->D & mask;
 			}
 		}
 
 		//Process unlock 
 		__CSL_UNLOCK(cuart);
 
+		UART_STATS_ADD(cuart, RxBytes, Size);
 		cuart->RxState = CSL_UART_STATE_READY;
 
 		return CSL_OK;
@@ -439,6 +559,76 @@ CSL_StatusTypeDef CSL_UART_Transmit_IT(UART_HandleTypeDef* cuart, uint8_t* TxBuf
 		cuart->pTxBuffer = TxBuffer;
 		cuart->pTxXferCount = Size;
 		cuart->pTxXferSize = Size;
+		cuart->pTxVec = NULL;
+		cuart->TxVecCount = 0u;
+		
+		//Process Unlock
+		__CSL_UNLOCK(cuart);
+		
+		//Enable UART Transmit data register empty Interrupt
+		SET_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+		
+		return CSL_OK;
+	}
+	else 
+	{
+		return CSL_Busy;
+	}
+}
+
+/**
+ * @brief	UART Vectored Transmit Function in IT(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			const CSL_IOVecTypeDef* pVec
+ *				Segments to be sent in order(empty Segments are skipped)
+ *			uint8_t Count
+ *				Number of Segments
+ * @return	CSL_StatusTypeDef
+ * @note	Segments are sent without copying, pVec and all of Segments must stay
+ *			valid until CSL_UART_TxCpltCallback(), which is called once for the whole Vector.
+ *			Size of Segment is counted in Data, 9-bit Data is stored as uint16_t.
+**/
+CSL_StatusTypeDef CSL_UART_TransmitV_IT(UART_HandleTypeDef* cuart, const CSL_IOVecTypeDef* pVec, uint8_t Count)
+{
+	uint32_t total = 0u;
+	uint8_t i = 0u;
+	
+	//Parameter Check
+	if((cuart == NULL) || (pVec == NULL) || (Count == 0u))
+	{
+		return CSL_Error;
+	}
+	
+	for(i = 0u; i < Count; i++)
+	{
+		total += pVec[i].Size;
+	}
+	if((total == 0u) || (total > 0xFFFFu))
+	{
+		return CSL_Error;
+	}
+	
+	//Skip leading empty Segments
+	while(pVec->Size == 0u)
+	{
+		pVec++;
+		Count--;
+	}
+	
+	//in Mode Transmitter IT
+	if(cuart->gState == CSL_UART_STATE_READY)
+	{
+		//Process Lock
+		__CSL_LOCK(cuart);
+		
+		cuart->gState = CSL_UART_STATE_BUSY_TX;
+		cuart->ErrorCode = CSL_UART_ERROR_NONE;
+		cuart->pTxBuffer = (uint8_t*)pVec->pData;
+		cuart->pTxXferCount = pVec->Size;
+		cuart->pTxXferSize = (uint16_t)total;
+		cuart->pTxVec = pVec + 1;
+		cuart->TxVecCount = Count - 1u;
 		
 		//Process Unlock
 		__CSL_UNLOCK(cuart);
@@ -501,186 +691,557 @@ CSL_StatusTypeDef CSL_UART_Receive_IT(UART_HandleTypeDef* cuart, uint8_t* RxBuff
 }
 
 /**
- * @brief   CSL UART Abort operations(called by UARTx_IRQHandler())
- * @param   UART_HandleTypeDef* cuart
-                UART Handle
- * @return  None
- * @note    None
+ * @brief	UART Receive into Ring Buffer in IT(no-blocking, never stops)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t* RingBuffer
+ *				Storage of Ring Buffer(supplied by user)
+ *			uint16_t Size
+ *				Size of Ring Buffer, must be power of 2 and not larger than 32768
+ * @return	CSL_StatusTypeDef
+ * @note	Every received byte is pushed into the Ring by UARTx_IRQHandler(),
+ *			read them out with CSL_UART_Read(), bytes arrived when Ring is full
+ *			are dropped and counted. Reception keeps running after errors,
+ *			call CSL_UART_Abort() to stop it. 9-bit data without parity is not
+ *			supported in this mode.
 **/
-void CSL_UART_Abort(UART_HandleTypeDef* cuart)
+CSL_StatusTypeDef CSL_UART_ReceiveToRing_IT(UART_HandleTypeDef* cuart, uint8_t* RingBuffer, uint16_t Size)
 {
-	//Disable all of Interrupts
-	CLEAR_BIT(cuart->Instance->BDH, 0x60u);
-	CLEAR_BIT(cuart->Instance->C2, 0xF0u);
-	CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
+	//Parameter Check
+	if((cuart == NULL) || (RingBuffer == NULL) || !IS_UART_RingSize(Size))
+	{
+		return CSL_Error;
+	}
 	
-	//Reset Tx Rx Buffer
-	cuart->pTxBuffer = 0;
-	cuart->pTxXferCount = 0u;
-	cuart->pTxXferSize = 0u;
-	cuart->pRxBuffer = 0;
-	cuart->pRxXferCount = 0u;
-	cuart->pRxXferSize = 0u;
+	//9-bit data can not be stored in byte Ring
+	if(UART_IS_9BIT_DATA(cuart))
+	{
+		return CSL_Error;
+	}
 	
-	//Reset Error Code
-	cuart->ErrorCode = CSL_UART_ERROR_NONE;
+	//in Mode Receiver IT
+	if(cuart->RxState == CSL_UART_STATE_READY)
+	{
+		//Process Lock
+		__CSL_LOCK(cuart);
+		
+		cuart->RxState = CSL_UART_STATE_BUSY_RX;
+		cuart->RxMode = UART_RxMode_Ring;
+		cuart->ErrorCode = CSL_UART_ERROR_NONE;
+		cuart->RxISR = UART_IS_7BIT_DATA(cuart) ? UART_RxISR_Ring7Bit : UART_RxISR_Ring8Bit;
+		
+		//Reset Ring Buffer
+		cuart->RxRing.pBuffer = RingBuffer;
+		cuart->RxRing.Mask = Size - 1u;
+		cuart->RxRing.Head = 0u;
+		cuart->RxRing.Tail = 0u;
+		cuart->RxRing.HighWater = 0u;
+		cuart->RxRing.Overflow = 0u;
+		
+		//Process Unlock
+		__CSL_UNLOCK(cuart);
+		
+		//Enable Receive Interrupt(RIE)
+		SET_BIT(cuart->Instance->C2, UART_C2_RIE_MASK);
+		
+		//Enable Error Interrupt(ORIE, NEIE, FEIE, PEIE)
+		SET_BIT(cuart->Instance->C3, 0x0Fu);
+		
+		return CSL_OK;
+	}
+	else
+	{
+		return CSL_Busy;
+	}
+}
+
+/**
+ * @brief	Read Data out of Receive Ring Buffer(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t* pData
+ *				Destination Buffer
+ *			uint16_t Size
+ *				Max Bytes to read
+ * @return	Bytes actually read, 0 if Ring is empty or not started
+ * @note	Only one context(Consumer) should read the Ring
+**/
+uint16_t CSL_UART_Read(UART_HandleTypeDef* cuart, uint8_t* pData, uint16_t Size)
+{
+	UART_RingTypeDef* ring = NULL;
+	uint16_t tail = 0u;
+	uint16_t count = 0u;
+	uint16_t i = 0u;
 	
-	//Reset Status
-	cuart->gState = CSL_UART_STATE_READY;
-	cuart->RxState = CSL_UART_STATE_READY;
+	//Ring is not started or aborted
+	if((cuart == NULL) || (pData == NULL) || (cuart->RxRing.pBuffer == NULL))
+	{
+		return 0u;
+	}
 	
-	//User Callback
-	CSL_UART_AbortCallback(cuart);
+	ring = &cuart->RxRing;
+	tail = ring->Tail;
+	count = (uint16_t)(ring->Head - tail);
+	
+	if(count > Size)
+	{
+		count = Size;
+	}
+	
+	for(i = 0u; i < count; i++)
+	{
+		pData[i] = ring->pBuffer[(uint16_t)(tail + i) & ring->Mask];
+	}
+	
+	//Data must be copied before Tail released to ISR
+	__DMB();
+	ring->Tail = tail + count;
+	
+	return count;
 }
 
 /**
- * @brief   CSL UART Abortion Callback(called by UARTx_IRQHandler())
- * @param   UART_HandleTypeDef* cuart
-                UART Handle
- * @return  None
- * @note    None
+ * @brief	Get Bytes held in Receive Ring Buffer
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	Bytes can be read
+ * @note	None
 **/
-__weak void CSL_UART_AbortCallback(UART_HandleTypeDef* cuart)
+uint16_t CSL_UART_GetRxCount(UART_HandleTypeDef* cuart)
 {
-	UNUSED(cuart);
+	if((cuart == NULL) || (cuart->RxRing.pBuffer == NULL))
+	{
+		return 0u;
+	}
+	
+	return (uint16_t)(cuart->RxRing.Head - cuart->RxRing.Tail);
 }
 
 /**
- * @brief   CSL UART IRQHandler(called by UARTx_IRQHandler())
- * @param   UART_HandleTypeDef* cuart
-                UART Handle
- * @return  None
- * @note    None
+ * @brief	Get High-water Mark of Receive Ring Buffer
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	Max Bytes ever held in Ring since CSL_UART_ReceiveToRing_IT()
+ * @note	None
 **/
-void CSL_UART_IRQHandler(UART_HandleTypeDef* cuart)
+uint16_t CSL_UART_GetRxHighWater(UART_HandleTypeDef* cuart)
 {
-	//Get Error Flags
-	uint8_t isr_flags = 0x00u, it_flags = 0x00u;
-	uint8_t s1_flag = cuart->Instance->S1;
-	uint8_t errorflags = __CSL_UART_GET_IT(cuart->Instance->C3, 0x0Fu) && __CSL_UART_GET_FLAG(s1_flag, 0x0Fu);
+	return cuart->RxRing.HighWater;
+}
+
+/**
+ * @brief	Get Overflow Counter of Receive Ring Buffer
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	Bytes dropped since CSL_UART_ReceiveToRing_IT()
+ * @note	None
+**/
+uint32_t CSL_UART_GetRxOverflow(UART_HandleTypeDef* cuart)
+{
+	return cuart->RxRing.Overflow;
+}
+
+/**
+ * @brief	UART Receive Frames delimited by IDLE Line in IT(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t* Buffer0, uint8_t* Buffer1
+ *				Ping-Pong Buffers, each one holds a whole Frame
+ *			uint16_t Size
+ *				Size of each Buffer(in Data Words)
+ * @return	CSL_StatusTypeDef
+ * @note	A Frame ends when the line keeps IDLE for one character after
+ *			the stop bit or the Buffer is full, then the other Buffer takes
+ *			over and CSL_UART_RxEventCallback() is called with the Frame.
+ *			The Frame must be consumed before the next one is completed.
+ *			Frames with errors are discarded, call CSL_UART_Abort() to stop.
+**/
+CSL_StatusTypeDef CSL_UART_ReceiveToIdle_IT(UART_HandleTypeDef* cuart, uint8_t* Buffer0, uint8_t* Buffer1, uint16_t Size)
+{
+	//Parameter Check
+	if((cuart == NULL) || (Buffer0 == NULL) || (Buffer1 == NULL) || (Size == 0))
+	{
+		return CSL_Error;
+	}
 	
-	//no error occured
-	if(errorflags == RESET)
+	//in Mode Receiver IT
+	if(cuart->RxState == CSL_UART_STATE_READY)
 	{
-		//UARTx in Mode Receiver
-		it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_RIE_MASK);
-		isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_RDRF_MASK);
-		if((it_flags && isr_flags) == SET)
-		{
-			UART_Receive_IT(cuart);
-			return;
-		}
-		
-		//UARTx Rx Pin Level Interrupt
-		it_flags = __CSL_UART_GET_IT(cuart->Instance->BDH, UART_BDH_RXEDGIE_MASK);
-		isr_flags = __CSL_UART_GET_FLAG(cuart->Instance->S2, UART_S2_RXEDGIF_MASK);
-		if((it_flags && isr_flags) == SET)
-		{
-			//Clear Flags
-			cuart->Instance->S2 |= UART_S2_RXEDGIF_MASK;
-			//Disable Rx Edge Interrupt
-			cuart->Instance->BDH &= ~UART_BDH_RXEDGIE_MASK;
-			//User Callback
-			CSL_UART_RxLevelCallback(cuart);
-			return;
-		}
+		//Process Lock
+		__CSL_LOCK(cuart);
 		
-		//UARTx has detected LIN Break Point
-		it_flags = __CSL_UART_GET_IT(cuart->Instance->BDH, UART_BDH_LBKDIE_MASK);
-		isr_flags = __CSL_UART_GET_FLAG(cuart->Instance->S2, UART_S2_LBKDIF_MASK);
-		if((it_flags && isr_flags) == SET)
-		{
-			//clear LINBKP Flag
-			CLEAR_BIT(cuart->Instance->S2, UART_S2_LBKDIF_MASK);
+		cuart->RxState = CSL_UART_STATE_BUSY_RX;
+		cuart->RxMode = UART_RxMode_Idle;
+		cuart->ErrorCode = CSL_UART_ERROR_NONE;
 		
-			//Disable LINBKP Interrupt
-			CLEAR_BIT(cuart->Instance->BDH, UART_BDH_LBKDIE_MASK);
+		cuart->pRxFrame[0] = Buffer0;
+		cuart->pRxFrame[1] = Buffer1;
+		cuart->RxFrameIndex = 0u;
+		cuart->pRxBuffer = Buffer0;
+		cuart->pRxXferCount = Size;
+		cuart->pRxXferSize = Size;
 		
-			//Break Point Detection Callback
-			CSL_UART_LIN_BKPCallback(cuart);
-			
-			return;
-		}
+		//Process Unlock
+		__CSL_UNLOCK(cuart);
 		
-		//UARTx IDLE Interrupt
-		it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_ILIE_MASK);
-		isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_IDLE_MASK);
-		if((it_flags && isr_flags) == SET)
-		{
-			//Clear IDLE Flag
-			__CSL_UART_FLUSH_S1(cuart);
-			__CSL_UART_FLUSH_DR(cuart);
-			//IDLE User Callback
-			CSL_UART_IDLECallback(cuart);
-			/** Disable Interrupt or not depends on user **/
-		}
+		//IDLE Character is counted after Stop Bit
+		SET_BIT(cuart->Instance->C1, UART_C1_ILT_MASK);
+		
+		//Clear the stale IDLE Flag
+		__CSL_UART_FLUSH_S1(cuart);
+		__CSL_UART_FLUSH_DR(cuart);
+		
+		//Enable Receive Interrupt(RIE, ILIE)
+		SET_BIT(cuart->Instance->C2, UART_C2_RIE_MASK | UART_C2_ILIE_MASK);
+		
+		//Enable Error Interrupt(ORIE, NEIE, FEIE, PEIE)
+		SET_BIT(cuart->Instance->C3, 0x0Fu);
+		
+		return CSL_OK;
+	}
+	else
+	{
+		return CSL_Busy;
+	}
+}
+
+/**
+ * @brief	UART Frame Received Callback(IDLE Reception)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t* pFrame
+ *				Buffer holding the Frame
+ *			uint16_t Length
+ *				Length of the Frame(in Data Words)
+ * @return	None
+ * @note	None
+**/
+__weak void CSL_UART_RxEventCallback(UART_HandleTypeDef* cuart, uint8_t* pFrame, uint16_t Length)
+{
+	UNUSED(cuart);
+	UNUSED(pFrame);
+	UNUSED(Length);
+}
+
+/**
+ * @brief	UART Receive Frames addressed to this Node in IT(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle(9 bit Data without Parity)
+ *			uint8_t* Buffer0, uint8_t* Buffer1
+ *				Ping-Pong Buffers, each one holds the Data Bytes of a whole Frame
+ *			uint16_t Size
+ *				Size of each Buffer(in Bytes)
+ *			uint8_t Address
+ *				Node Address
+ *			uint16_t Broadcast
+ *				Broadcast Address, UART_Address_None if not used
+ * @return	CSL_StatusTypeDef
+ * @note	A Frame is one Address Word(9th Bit set) followed by Data Words(9th Bit clear).
+ *			The Receiver is muted(RWU) through Frames of other Nodes and woken by
+ *			Hardware on the next Address Mark, so only one Interrupt is taken for them.
+ *			A Frame ends on IDLE Line, next Address Word or full Buffer, then
+ *			CSL_UART_RxEventCallback() is called and cuart->RxAddress holds its Address.
+**/
+CSL_StatusTypeDef CSL_UART_ReceiveAddressed_IT(UART_HandleTypeDef* cuart, uint8_t* Buffer0, uint8_t* Buffer1, uint16_t Size, uint8_t Address, uint16_t Broadcast)
+{
+	//Parameter Check
+	if((cuart == NULL) || (Buffer0 == NULL) || (Buffer1 == NULL) || (Size == 0))
+	{
+		return CSL_Error;
 	}
 	
-	//Some errors occured
-	if(errorflags == SET)
+	//Address Mark is the 9th Data Bit
+	if(!UART_IS_9BIT_DATA(cuart))
 	{
-		//Error Overflow
-		if((s1_flag & UART_Err_OR) != RESET)
-		{
-			cuart->ErrorCode = CSL_UART_ERROR_ORE;
-		}
+		return CSL_Error;
+	}
+	
+	//in Mode Receiver IT
+	if(cuart->RxState == CSL_UART_STATE_READY)
+	{
+		//Process Lock
+		__CSL_LOCK(cuart);
 		
-		//Error Noise
-		if((s1_flag & UART_Err_NF) != RESET)
-		{
-			cuart->ErrorCode = CSL_UART_ERROR_NE;
-		}
+		cuart->RxState = CSL_UART_STATE_BUSY_RX;
+		cuart->RxMode = UART_RxMode_Address;
+		cuart->ErrorCode = CSL_UART_ERROR_NONE;
+		cuart->RxISR = UART_RxISR_Address;
 		
-		//Error Frame-error
-		if((s1_flag & UART_Err_FE) != RESET)
-		{
-			cuart->ErrorCode = CSL_UART_ERROR_FE;
-		}
+		cuart->RxNodeAddress = Address;
+		cuart->RxBroadcast = Broadcast;
+		cuart->pRxFrame[0] = Buffer0;
+		cuart->pRxFrame[1] = Buffer1;
+		cuart->RxFrameIndex = 0u;
+		cuart->pRxBuffer = Buffer0;
+		cuart->pRxXferCount = Size;
+		cuart->pRxXferSize = Size;
 		
-		//Error Parity
-		if((s1_flag && UART_Err_PF) != RESET)
-		{
-			cuart->ErrorCode = CSL_UART_ERROR_PE;
-		}
+		//Process Unlock
+		__CSL_UNLOCK(cuart);
 		
-		//Clear the Error Flags
+		//Address Mark Wake-up, IDLE is not flagged while muted
+		SET_BIT(cuart->Instance->C1, UART_C1_WAKE_MASK | UART_C1_ILT_MASK);
+		__CSL_UART_DISABLE_IDLE(cuart);
+		
+		//Clear the stale Flags
 		__CSL_UART_FLUSH_S1(cuart);
 		__CSL_UART_FLUSH_DR(cuart);
 		
-		//Disable Error Interrupt
-		CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
+		//Sleep until the first Address Word
+		UART_RX_MUTE(cuart);
 		
-		//Reset UART Handle
-		cuart->gState = CSL_UART_STATE_READY;
-		cuart->RxState = CSL_UART_STATE_READY;
+		//Enable Receive Interrupt(RIE, ILIE)
+		SET_BIT(cuart->Instance->C2, UART_C2_RIE_MASK | UART_C2_ILIE_MASK);
 		
-		//Error Callback Funtion
-		CSL_UART_ErrorCallback(cuart);
+		//Enable Error Interrupt(ORIE, NEIE, FEIE, PEIE)
+		SET_BIT(cuart->Instance->C3, 0x0Fu);
 		
-		//Clear Error Code
+		return CSL_OK;
+	}
+	else
+	{
+		return CSL_Busy;
+	}
+}
+
+/**
+ * @brief	UART Transmit from Ring Buffer in IT(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			uint8_t* RingBuffer
+ *				Storage of Ring Buffer(supplied by user)
+ *			uint16_t Size
+ *				Size of Ring Buffer, must be power of 2 and not larger than 32768
+ * @return	CSL_StatusTypeDef
+ * @note	The Transmitter is owned by the Ring until CSL_UART_Abort(),
+ *			queue data with CSL_UART_Write(). 9-bit data without parity is not
+ *			supported in this mode.
+**/
+CSL_StatusTypeDef CSL_UART_TransmitFromRing_IT(UART_HandleTypeDef* cuart, uint8_t* RingBuffer, uint16_t Size)
+{
+	//Parameter Check
+	if((cuart == NULL) || (RingBuffer == NULL) || !IS_UART_RingSize(Size))
+	{
+		return CSL_Error;
+	}
+	
+	//9-bit data can not be stored in byte Ring
+	if(UART_IS_9BIT_DATA(cuart))
+	{
+		return CSL_Error;
+	}
+	
+	//in Mode Transmitter IT
+	if(cuart->gState == CSL_UART_STATE_READY)
+	{
+		//Process Lock
+		__CSL_LOCK(cuart);
+		
+		cuart->gState = CSL_UART_STATE_BUSY_TX;
+		cuart->TxMode = UART_TxMode_Ring;
 		cuart->ErrorCode = CSL_UART_ERROR_NONE;
+		cuart->TxISR = UART_TxISR_Ring;
 		
-		//exit
-		return;
+		//Reset Ring Buffer
+		cuart->TxRing.pBuffer = RingBuffer;
+		cuart->TxRing.Mask = Size - 1u;
+		cuart->TxRing.Head = 0u;
+		cuart->TxRing.Tail = 0u;
+		cuart->TxRing.HighWater = 0u;
+		cuart->TxRing.Overflow = 0u;
+		cuart->TxLock = CSL_UNLOCKED;
+		
+		//Process Unlock
+		__CSL_UNLOCK(cuart);
+		
+		/* Note: TIE is enabled by CSL_UART_Write() */
+		
+		return CSL_OK;
 	}
+	else
+	{
+		return CSL_Busy;
+	}
+}
+
+/**
+ * @brief	Queue Data into Transmit Ring Buffer(no-blocking)
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			const uint8_t* pData
+ *				Data to be sent
+ *			uint16_t Size
+ *				Size of Data
+ * @return	CSL_OK		all of Data is queued
+ *			CSL_Busy	Ring has not enough space or is being written by
+ *						an interrupted context, nothing is queued
+ *			CSL_Error	Transmit Ring is not started
+ * @note	Can be called in thread and interrupt contexts. A context which
+ *			interrupts another writer gets CSL_Busy instead of spinning, the
+ *			dropped bytes are counted in the Ring Overflow.
+**/
+CSL_StatusTypeDef CSL_UART_Write(UART_HandleTypeDef* cuart, const uint8_t* pData, uint16_t Size)
+{
+	UART_RingTypeDef* ring = &cuart->TxRing;
+	uint16_t head = 0u, count = 0u, i = 0u;
 	
-	//UARTx is in Mode Transmitter
-	it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_TIE_MASK);
-	isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_TDRE_MASK);
-	if((it_flags && isr_flags) == SET)
+	//Parameter Check
+	if((pData == NULL) || (cuart->TxMode != UART_TxMode_Ring))
 	{
-		UART_Transmit_IT(cuart);
-		return;
+		return CSL_Error;
 	}
 	
-	//UARTx is in Mode Transmitter
-	it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_TCIE_MASK);
-	isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_TC_MASK);
-	if((it_flags && isr_flags) == SET)
+	//Another writer is interrupted
+	if(cuart->TxLock == CSL_LOCKED)
 	{
-		UART_EndTransmit_IT(cuart);
-		return;
+		ring->Overflow += Size;
+		return CSL_Busy;
+	}
+	cuart->TxLock = CSL_LOCKED;
+	
+	head = ring->Head;
+	count = (uint16_t)(head - ring->Tail);
+	
+	//Not enough space, drop the whole Data
+	if(Size > (uint16_t)(ring->Mask + 1u - count))
+	{
+		ring->Overflow += Size;
+		cuart->TxLock = CSL_UNLOCKED;
+		return CSL_Busy;
+	}
+	
+	for(i = 0u; i < Size; i++)
+	{
+		ring->pBuffer[(uint16_t)(head + i) & ring->Mask] = pData[i];
+	}
+	
+	//Data must be stored before Head released to ISR
+	__DMB();
+	ring->Head = head + Size;
+	
+	//High-water Mark
+	count += Size;
+	if(count > ring->HighWater)
+	{
+		ring->HighWater = count;
+	}
+	
+	cuart->TxLock = CSL_UNLOCKED;
+	
+	//Enable Transmit data register empty Interrupt
+	SET_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+	
+	return CSL_OK;
+}
+
+/**
+ * @brief	Get High-water Mark of Transmit Ring Buffer
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	Max Bytes ever held in Ring since CSL_UART_TransmitFromRing_IT()
+ * @note	None
+**/
+uint16_t CSL_UART_GetTxHighWater(UART_HandleTypeDef* cuart)
+{
+	return cuart->TxRing.HighWater;
+}
+
+/**
+ * @brief	Get Overflow Counter of Transmit Ring Buffer
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	Bytes rejected by CSL_UART_Write() since CSL_UART_TransmitFromRing_IT()
+ * @note	None
+**/
+uint32_t CSL_UART_GetTxOverflow(UART_HandleTypeDef* cuart)
+{
+	return cuart->TxRing.Overflow;
+}
+
+/**
+ * @brief   CSL UART Abort operations(called by UARTx_IRQHandler())
+ * @param   UART_HandleTypeDef* cuart
+                UART Handle
+ * @return  None
+ * @note    None
+**/
+void CSL_UART_Abort(UART_HandleTypeDef* cuart)
+{
+	//Disable all of Interrupts
+	CLEAR_BIT(cuart->Instance->BDH, 0x60u);
+	CLEAR_BIT(cuart->Instance->C2, 0xF0u | UART_C2_RWU_MASK);
+	CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
+	
+	//Reset Tx Rx Buffer
+	cuart->pTxBuffer = 0;
+	cuart->pTxXferCount = 0u;
+	cuart->pTxXferSize = 0u;
+	cuart->pTxVec = NULL;
+	cuart->TxVecCount = 0u;
+	cuart->TxRing.pBuffer = 0;
+	cuart->TxRing.Head = cuart->TxRing.Tail;
+	cuart->TxMode = UART_TxMode_Buffer;
+	UART_RS485_Release(cuart);
+	cuart->pRxBuffer = 0;
+	cuart->pRxXferCount = 0u;
+	cuart->pRxXferSize = 0u;
+	cuart->RxRing.pBuffer = 0;
+	cuart->RxRing.Head = cuart->RxRing.Tail;
+	cuart->RxMode = UART_RxMode_Buffer;
+	UART_SetISR(cuart);
+	
+	//Reset Error Code
+	cuart->ErrorCode = CSL_UART_ERROR_NONE;
+	
+	//Reset Status
+	cuart->gState = CSL_UART_STATE_READY;
+	cuart->RxState = CSL_UART_STATE_READY;
+	
+	//User Callback
+	CSL_UART_AbortCallback(cuart);
+}
+
+/**
+ * @brief   CSL UART Abortion Callback(called by UARTx_IRQHandler())
+ * @param   UART_HandleTypeDef* cuart
+                UART Handle
+ * @return  None
+ * @note    None
+**/
+__weak void CSL_UART_AbortCallback(UART_HandleTypeDef* cuart)
+{
+	UNUSED(cuart);
+}
+
+/**
+ * @brief   CSL UART IRQHandler(called by UARTx_IRQHandler())
+ * @param   UART_HandleTypeDef* cuart
+                UART Handle
+ * @return  None
+ * @note    None
+**/
+void CSL_UART_IRQHandler(UART_HandleTypeDef* cuart)
+{
+#if (UART_STATISTICS_STAT == 0x01u)
+	//SysTick counts down and reloads every 1ms
+	uint32_t start = SysTick->VAL, end = 0u, cycles = 0u;
+	
+	UART_IRQHandler(cuart);
+	
+	end = SysTick->VAL;
+	cycles = (end <= start) ? (start - end) : (start + SysTick->LOAD + 1u - end);
+	
+	cuart->Stats.IRQCount++;
+	if(cycles > cuart->Stats.IRQMaxCycles)
+	{
+		cuart->Stats.IRQMaxCycles = cycles;
 	}
+	
+	//Readers retry when this is changed
+	cuart->Stats.Sequence++;
+#else
+	UART_IRQHandler(cuart);
+#endif /*UART_STATISTICS_STAT == 0x01u*/
 }
 
 /**
@@ -859,6 +1420,47 @@ uint32_t CSL_UART_GetError(UART_HandleTypeDef* cuart)
 	return cuart->ErrorCode;
 }
 
+#if (UART_STATISTICS_STAT == 0x01u)
+/**
+ * @brief	Get a consistent Snapshot of UART Statistics
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ *			UART_StatsTypeDef* pStats
+ *				Snapshot Destination
+ * @return	None
+ * @note	The copy is retried if CSL_UART_IRQHandler() ran in between,
+ *			so interrupts need not be masked. IRQMaxCycles is in Core Clocks
+ *			and assumes the IRQHandler is shorter than one SysTick period.
+**/
+void CSL_UART_GetStatistics(UART_HandleTypeDef* cuart, UART_StatsTypeDef* pStats)
+{
+	uint32_t sequence = 0u;
+	
+	do
+	{
+		sequence = cuart->Stats.Sequence;
+		__DMB();
+		*pStats = cuart->Stats;
+		__DMB();
+	}while(sequence != cuart->Stats.Sequence);
+}
+
+/**
+ * @brief	Reset UART Statistics
+ * @param	UART_HandleTypeDef* cuart
+ *				UART Handle
+ * @return	None
+ * @note	Statistics are kept across CSL_UART_Init(), reset them here
+**/
+void CSL_UART_ResetStatistics(UART_HandleTypeDef* cuart)
+{
+	UART_StatsTypeDef stats = {0};
+	
+	stats.Sequence = cuart->Stats.Sequence + 1u;
+	cuart->Stats = stats;
+}
+#endif /*UART_STATISTICS_STAT == 0x01u*/
+
 /** UART Private Functions(do not call these in user code) **/
 /**
  * @brief	Configure UART with UART_Handle
@@ -901,6 +1503,9 @@ static void UART_Config(UART_HandleTypeDef* cuart)
 	cuart->Instance->BDL = (uint8_t)(baudrate & 0xFFu);
 	cuart->Instance->C1 = cuart->Init.UART_Line | cuart->Init.WordLength | cuart->Init.Parity;
 	cuart->Instance->C2 = cuart->Init.UART_Mode;
+	
+	/* Per-byte Handlers of the Frame Format */
+	UART_SetISR(cuart);
 }
 
 /** 
@@ -941,137 +1546,632 @@ static CSL_StatusTypeDef UART_WaitFlag(UART_HandleTypeDef* cuart, uint8_t Flag,
 }
 
 /**
- * @brief	Transmit in IT
+ * @brief	Select ISR Handlers specialised to the Frame Format
+ * @note	8 bit Data:	8 bit without Parity, 9 bit with Parity
+ *			7 bit Data:	8 bit with Parity(Parity Bit is the MSB of UARTx->D)
+ *			9 bit Data:	9 bit without Parity(MSB is in UARTx->C3[T8/R8])
 **/
-static CSL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef* cuart)
+static void UART_SetISR(UART_HandleTypeDef* cuart)
 {
-	uint16_t* tmp = 0;
-	
-	/** Clear TDRE Flag --> Read UARTx->S1, Write UARTx->D */
-	
-	//Check Transmit Process is ongoing or not
-	if(cuart->gState == CSL_UART_STATE_BUSY_TX)
+	if(UART_IS_9BIT_DATA(cuart))
 	{
-		//Read UARTx->S1
-		__CSL_UART_FLUSH_S1(cuart);
-		
-		//Word length is 9 bit
-		if(cuart->Init.WordLength == UART_Word_9B)
-		{
-			tmp = (uint16_t*)cuart->pTxBuffer;
-			//Write Data to UARTx->C3[T8] & UARTx->D
-			CLEAR_BIT(cuart->Instance->C3, UART_C3_T8_MASK);
-			cuart->Instance->C3 = ((*tmp >> 1) & 0x80u) | cuart->Instance->C3;
-			cuart->Instance->D = (uint8_t)(*tmp & (uint8_t)0xFF);
-			if(cuart->Init.Parity == UART_Parity_None)
-			{
-				cuart->pTxBuffer += 2u;
-			}
-			else
-			{
-				cuart->pTxBuffer += 1u;
-			}
-		}
+		cuart->TxISR = UART_TxISR_9Bit;
+		cuart->RxISR = UART_RxISR_9Bit;
+	}
+	else if(UART_IS_7BIT_DATA(cuart))
+	{
+		cuart->TxISR = UART_TxISR_8Bit;
+		cuart->RxISR = UART_RxISR_7Bit;
+	}
+	else
+	{
+		cuart->TxISR = UART_TxISR_8Bit;
+		cuart->RxISR = UART_RxISR_8Bit;
+	}
+}
+
+/**
+ * @brief	Transmit in IT(8 bit & 7 bit Data)
+ * @note	UARTx->S1 has been read in IRQHandler, writing UARTx->D clears TDRE
+**/
+static void UART_TxISR_8Bit(UART_HandleTypeDef* cuart)
+{
+	cuart->Instance->D = *cuart->pTxBuffer++;
+	UART_STATS_INC(cuart, TxBytes);
+	
+	//Check Transmit is Completed or not
+	if((--cuart->pTxXferCount == 0u) && (UART_NextSegment(cuart) == RESET))
+	{
+		//Disbale the Transmit Cache Empty Interrupt
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
 		
-		//Word length is 8 bit
-		else
-		{
-			cuart->Instance->D = (uint8_t)(*cuart->pTxBuffer++ & (uint8_t)0xFF);
-		}
+		//Enable the Transmit Complete Interrupt
+		SET_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+	}
+}
+
+/**
+ * @brief	Transmit in IT(9 bit Data, stored as uint16_t)
+**/
+static void UART_TxISR_9Bit(UART_HandleTypeDef* cuart)
+{
+	uint16_t data = *(uint16_t*)cuart->pTxBuffer;
+	
+	//UARTx->C3[T8] must be written before UARTx->D
+	MODIFY_REG(cuart->Instance->C3, UART_C3_T8_MASK, (data >> 2u) & UART_C3_T8_MASK);
+	cuart->Instance->D = (uint8_t)data;
+	cuart->pTxBuffer += 2u;
+	UART_STATS_INC(cuart, TxBytes);
+	
+	//Check Transmit is Completed or not
+	if((--cuart->pTxXferCount == 0u) && (UART_NextSegment(cuart) == RESET))
+	{
+		//Disbale the Transmit Cache Empty Interrupt
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
 		
-		//Check Transmit is Completed or not
-		if(--cuart->pRxXferCount == 0u)
+		//Enable the Transmit Complete Interrupt
+		SET_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+	}
+}
+
+/**
+ * @brief	Transmit from Ring Buffer in IT
+**/
+static void UART_TxISR_Ring(UART_HandleTypeDef* cuart)
+{
+	UART_RingTypeDef* ring = &cuart->TxRing;
+	uint16_t tail = ring->Tail;
+	
+	if(ring->Head != tail)
+	{
+		cuart->Instance->D = ring->pBuffer[tail & ring->Mask];
+		ring->Tail = ++tail;
+		UART_STATS_INC(cuart, TxBytes);
+	}
+	
+	//Ring is empty, wait for Transmit Complete
+	if(ring->Head == tail)
+	{
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+		SET_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+	}
+}
+
+/**
+ * @brief	Walk to next non-empty Segment of Vectored Transmit
+ * @return	SET if a Segment is loaded, RESET if the Vector is done
+**/
+static Flag_Status UART_NextSegment(UART_HandleTypeDef* cuart)
+{
+	while(cuart->TxVecCount > 0u)
+	{
+		cuart->TxVecCount--;
+		cuart->pTxBuffer = (uint8_t*)cuart->pTxVec->pData;
+		cuart->pTxXferCount = cuart->pTxVec->Size;
+		cuart->pTxVec++;
+		if(cuart->pTxXferCount != 0u)
 		{
-			//Disbale the Transmit Cache Empty Interrupt
-			CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
-			
-			//Enable the Transmit Complete Interrupt
-			SET_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+			return SET;
 		}
-		
-		return CSL_OK;
 	}
-	else return CSL_Busy;
+	
+	return RESET;
 }
 
 /**
  * @brief 	Transmit End in IT
 **/
-CSL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef* cuart)
+static CSL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef* cuart)
 {
+	//RS-485 Guard Time is running
+	if(UART_RS485_ENABLED(cuart) && (UART_RS485_EndPhase(cuart) == RESET))
+	{
+		return CSL_OK;
+	}
+	
 	//Disable Transmit Complete Interrupt
 	CLEAR_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
 	
+	//Transmit Ring is still owned by the Transmitter
+	if(cuart->TxMode == UART_TxMode_Ring)
+	{
+		//Data queued after Ring was drained
+		if(cuart->TxRing.Head != cuart->TxRing.Tail)
+		{
+			SET_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+		}
+		else
+		{
+			UART_STATS_INC(cuart, TxCpltCallbacks);
+			CSL_UART_TxCpltCallback(cuart);
+		}
+		return CSL_OK;
+	}
+	
 	//Transmit Process is ended
 	cuart->gState = CSL_UART_STATE_READY;
 	
 	//Transmit Complete Callback
+	UART_STATS_INC(cuart, TxCpltCallbacks);
 	CSL_UART_TxCpltCallback(cuart);
 	
 	return CSL_OK;
 }
 
 /**
- * @brief	Receive in IT
+ * @brief	Assert DE on the first TDRE Interrupt of a Transmit
+ * @note	During Lead/Tail Guard TIE is only masked, it is enabled again at the Guard end.
 **/
-static CSL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef* cuart)
+static void UART_RS485_Start(UART_HandleTypeDef* cuart)
 {
-	//Receiver
-	if(cuart->RxState == CSL_UART_STATE_BUSY_RX)
+	if(cuart->RS485.Phase != UART_RS485_Phase_Idle)
+	{
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+		return;
+	}
+	
+	//Driver on, local Echo off
+	UART_RS485_DE_ASSERT(cuart);
+	if(cuart->RS485.RxDisable == ENABLE)
+	{
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_RE_MASK);
+	}
+	
+	//No Lead Guard, first Data follows DE immediately
+	if(cuart->RS485.LeadGuard == 0u)
+	{
+		cuart->RS485.Phase = UART_RS485_Phase_Data;
+		cuart->TxISR(cuart);
+		return;
+	}
+	
+	//Lead Guard: Idle Characters chained by TC
+	cuart->RS485.Phase = UART_RS485_Phase_Lead;
+	cuart->RS485.GuardCount = cuart->RS485.LeadGuard;
+	CLEAR_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+	UART_QUEUE_IDLE(cuart);
+	SET_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+}
+
+/**
+ * @brief	Advance RS-485 Phase on TC Interrupt
+ * @return	SET if Transmit goes on as without RS-485, RESET if a Guard is running
+**/
+static Flag_Status UART_RS485_EndPhase(UART_HandleTypeDef* cuart)
+{
+	Flag_Status pending = ((cuart->TxMode == UART_TxMode_Ring) && (cuart->TxRing.Head != cuart->TxRing.Tail)) ? SET : RESET;
+	
+	switch(cuart->RS485.Phase)
+	{
+	case UART_RS485_Phase_Lead:
+		if(--cuart->RS485.GuardCount > 0u)
+		{
+			UART_QUEUE_IDLE(cuart);
+			return RESET;
+		}
+		//Lead Guard is over, start Data
+		cuart->RS485.Phase = UART_RS485_Phase_Data;
+		CLEAR_BIT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+		SET_BIT(cuart->Instance->C2, UART_C2_TIE_MASK);
+		return RESET;
+	case UART_RS485_Phase_Data:
+		//Ring is refilled, keep Driver on
+		if(pending == SET)
+		{
+			return SET;
+		}
+		if(cuart->RS485.TailGuard > 0u)
+		{
+			cuart->RS485.Phase = UART_RS485_Phase_Tail;
+			cuart->RS485.GuardCount = cuart->RS485.TailGuard;
+			UART_QUEUE_IDLE(cuart);
+			return RESET;
+		}
+		break;
+	case UART_RS485_Phase_Tail:
+		if(--cuart->RS485.GuardCount > 0u)
+		{
+			UART_QUEUE_IDLE(cuart);
+			return RESET;
+		}
+		if(pending == SET)
+		{
+			cuart->RS485.Phase = UART_RS485_Phase_Data;
+			return SET;
+		}
+		break;
+	default:
+		return SET;
+	}
+	
+	UART_RS485_Release(cuart);
+	return SET;
+}
+
+/**
+ * @brief	Release DE & re-enable Receiver
+**/
+static void UART_RS485_Release(UART_HandleTypeDef* cuart)
+{
+	if(!UART_RS485_ENABLED(cuart))
+	{
+		return;
+	}
+	
+	UART_RS485_DE_RELEASE(cuart);
+	cuart->RS485.Phase = UART_RS485_Phase_Idle;
+	
+	//Receiver back on without stale Flags
+	if(cuart->RS485.RxDisable == ENABLE)
 	{
-		uint16_t* tmp = 0;
-		uint8_t data = 0;
-		
-		//Clear RDRF Flag
 		__CSL_UART_FLUSH_S1(cuart);
+		__CSL_UART_FLUSH_DR(cuart);
+		SET_BIT(cuart->Instance->C2, cuart->Init.UART_Mode & UART_C2_RE_MASK);
+	}
+}
+
+/**
+ * @brief	Receive in IT(8 bit Data)
+ * @note	UARTx->S1 has been read in IRQHandler, reading UARTx->D clears RDRF
+**/
+static void UART_RxISR_8Bit(UART_HandleTypeDef* cuart)
+{
+	*cuart->pRxBuffer++ = cuart->Instance->D;
+	UART_STATS_INC(cuart, RxBytes);
+	
+	if(--cuart->pRxXferCount == 0u)
+	{
+		UART_EndReceive_IT(cuart);
+	}
+}
+
+/**
+ * @brief	Receive in IT(7 bit Data, Parity Bit removed)
+**/
+static void UART_RxISR_7Bit(UART_HandleTypeDef* cuart)
+{
+	*cuart->pRxBuffer++ = cuart->Instance->D & 0x7Fu;
+	UART_STATS_INC(cuart, RxBytes);
+	
+	if(--cuart->pRxXferCount == 0u)
+	{
+		UART_EndReceive_IT(cuart);
+	}
+}
+
+/**
+ * @brief	Receive in IT(9 bit Data, stored as uint16_t)
+**/
+static void UART_RxISR_9Bit(UART_HandleTypeDef* cuart)
+{
+	//UARTx->C3[R8] must be read before UARTx->D
+	uint16_t data = (uint16_t)(cuart->Instance->C3 & UART_C3_R8_MASK) << 1u;
+	*(uint16_t*)cuart->pRxBuffer = data | cuart->Instance->D;
+	cuart->pRxBuffer += 2u;
+	UART_STATS_INC(cuart, RxBytes);
+	
+	if(--cuart->pRxXferCount == 0u)
+	{
+		UART_EndReceive_IT(cuart);
+	}
+}
+
+/**
+ * @brief	Receive into Ring Buffer in IT(8 bit Data)
+**/
+static void UART_RxISR_Ring8Bit(UART_HandleTypeDef* cuart)
+{
+	UART_PushRing(&cuart->RxRing, cuart->Instance->D);
+	UART_STATS_INC(cuart, RxBytes);
+}
+
+/**
+ * @brief	Receive into Ring Buffer in IT(7 bit Data, Parity Bit removed)
+**/
+static void UART_RxISR_Ring7Bit(UART_HandleTypeDef* cuart)
+{
+	UART_PushRing(&cuart->RxRing, cuart->Instance->D & 0x7Fu);
+	UART_STATS_INC(cuart, RxBytes);
+}
+
+/**
+ * @brief	Receive Frames addressed to this Node in IT(9 bit Data, MSB is Address Mark)
+**/
+static void UART_RxISR_Address(UART_HandleTypeDef* cuart)
+{
+	//UARTx->C3[R8] must be read before UARTx->D
+	uint8_t mark = cuart->Instance->C3 & UART_C3_R8_MASK;
+	uint8_t data = cuart->Instance->D;
+	UART_STATS_INC(cuart, RxBytes);
+	
+	//Data Word of an accepted Frame
+	if(mark == 0u)
+	{
+		*cuart->pRxBuffer++ = data;
+		if(--cuart->pRxXferCount == 0u)
+		{
+			UART_EndReceive_IT(cuart);
+		}
+		return;
+	}
+	
+	//Address Word ends the current Frame
+	UART_EndFrame_IT(cuart);
+	
+	if((data == cuart->RxNodeAddress) || (data == cuart->RxBroadcast))
+	{
+		cuart->RxAddress = data;
+	}
+	else
+	{
+		//Frame for other Nodes, sleep through it
+		UART_RX_MUTE(cuart);
+	}
+}
+
+/**
+ * @brief	Push a byte into Receive Ring(Producer is ISR)
+**/
+static void UART_PushRing(UART_RingTypeDef* ring, uint8_t data)
+{
+	uint16_t head = ring->Head;
+	uint16_t count = (uint16_t)(head - ring->Tail);
+	
+	//Ring is full, drop the byte
+	if(count > ring->Mask)
+	{
+		ring->Overflow++;
+		return;
+	}
+	
+	ring->pBuffer[head & ring->Mask] = data;
+	
+	//Data must be stored before Head released to Consumer
+	__DMB();
+	ring->Head = head + 1u;
+	
+	//High-water Mark
+	if(++count > ring->HighWater)
+	{
+		ring->HighWater = count;
+	}
+}
+
+/**
+ * @brief	Receive Buffer is full in IT
+**/
+static void UART_EndReceive_IT(UART_HandleTypeDef* cuart)
+{
+	//Buffer is full, the Frame ends
+	if(UART_IS_FRAME_MODE(cuart))
+	{
+		UART_EndFrame_IT(cuart);
 		
-		//Word length is 9 bit
-		if(cuart->Init.WordLength == UART_Word_9B)
+		//Discard the rest of an oversized Frame
+		if(cuart->RxMode == UART_RxMode_Address)
 		{
-			tmp = (uint16_t*)cuart->pRxBuffer;
-			data = cuart->Instance->D;
-			if(cuart->Init.Parity == UART_Parity_None)
-			{
-				*tmp = (uint16_t)(((cuart->Instance->C3 & 0x80u << 1u) | data) & 0x01FFu);
-				cuart->pRxBuffer += 2u;
-			}
-			else
-			{
-				*tmp = (uint16_t)(cuart->Instance->D & 0x00FFu);
-				cuart->pRxBuffer += 1u;
-			}
+			UART_RX_MUTE(cuart);
 		}
-		//Word length is 8 bit
-		else
+		return;
+	}
+	
+	//Disable Receive Interrupt(RIE, ILIE)
+	CLEAR_BIT(cuart->Instance->C2, UART_C2_RIE_MASK | UART_C2_ILIE_MASK);
+	
+	//Disable Error Interrupt(ORIE, NEIE, FEIE, PEIE)
+	CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
+	
+	cuart->RxState = CSL_UART_STATE_READY;
+	
+	//User Callback
+	UART_STATS_INC(cuart, RxCpltCallbacks);
+	CSL_UART_RxCpltCallback(cuart);
+}
+
+/**
+ * @brief	End a Frame of IDLE Reception and swap the Ping-Pong Buffers
+**/
+static void UART_EndFrame_IT(UART_HandleTypeDef* cuart)
+{
+	uint8_t* frame = cuart->pRxFrame[cuart->RxFrameIndex];
+	uint16_t length = cuart->pRxXferSize - cuart->pRxXferCount;
+	
+	//IDLE after a full Buffer, nothing received
+	if(length == 0u)
+	{
+		return;
+	}
+	
+	//Next Frame goes to the other Buffer immediately
+	cuart->RxFrameIndex ^= 1u;
+	cuart->pRxBuffer = cuart->pRxFrame[cuart->RxFrameIndex];
+	cuart->pRxXferCount = cuart->pRxXferSize;
+	
+	//User Callback
+	UART_STATS_INC(cuart, RxEventCallbacks);
+	CSL_UART_RxEventCallback(cuart, frame, length);
+}
+
+/**
+ * @brief	Dispatch UART Interrupt Sources
+**/
+static void UART_IRQHandler(UART_HandleTypeDef* cuart)
+{
+	//Get Error Flags
+	uint8_t isr_flags = 0x00u, it_flags = 0x00u;
+	uint8_t s1_flag = cuart->Instance->S1;
+	uint8_t errorflags = __CSL_UART_GET_IT(cuart->Instance->C3, 0x0Fu) && __CSL_UART_GET_FLAG(s1_flag, 0x0Fu);
+	
+	//no error occured
+	if(errorflags == RESET)
+	{
+		//UARTx in Mode Receiver
+		it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_RIE_MASK);
+		isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_RDRF_MASK);
+		if((it_flags && isr_flags) == SET)
+		{
+			cuart->RxISR(cuart);
+			return;
+		}
+		
+		//UARTx Rx Pin Level Interrupt
+		it_flags = __CSL_UART_GET_IT(cuart->Instance->BDH, UART_BDH_RXEDGIE_MASK);
+		isr_flags = __CSL_UART_GET_FLAG(cuart->Instance->S2, UART_S2_RXEDGIF_MASK);
+		if((it_flags && isr_flags) == SET)
+		{
+			//Clear Flags
+			__CSL_UART_CLEAR_RXEDGIF(cuart);
+			//Disable Rx Edge Interrupt
+			cuart->Instance->BDH &= ~UART_BDH_RXEDGIE_MASK;
+			//User Callback
+			UART_STATS_INC(cuart, RxLevelCallbacks);
+			CSL_UART_RxLevelCallback(cuart);
+			return;
+		}
+		
+		//UARTx has detected LIN Break Point
+		it_flags = __CSL_UART_GET_IT(cuart->Instance->BDH, UART_BDH_LBKDIE_MASK);
+		isr_flags = __CSL_UART_GET_FLAG(cuart->Instance->S2, UART_S2_LBKDIF_MASK);
+		if((it_flags && isr_flags) == SET)
 		{
-			if(cuart->Init.Parity == UART_Parity_None)
+			//clear LINBKP Flag(w1c)
+			__CSL_UART_CLEAR_LBKDIF(cuart);
+		
+			//Disable LINBKP Interrupt
+			CLEAR_BIT(cuart->Instance->BDH, UART_BDH_LBKDIE_MASK);
+		
+			//Break Point Detection Callback
+			UART_STATS_INC(cuart, LinBreakCallbacks);
+			CSL_UART_LIN_BKPCallback(cuart);
+			
+			return;
+		}
+		
+		//UARTx IDLE Interrupt
+		it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_ILIE_MASK);
+		isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_IDLE_MASK);
+		if((it_flags && isr_flags) == SET)
+		{
+			//Clear IDLE Flag
+			__CSL_UART_FLUSH_S1(cuart);
+			__CSL_UART_FLUSH_DR(cuart);
+			//IDLE ends the Frame
+			if(UART_IS_FRAME_MODE(cuart))
 			{
-				*cuart->pRxBuffer++ = (uint8_t)(cuart->Instance->D & 0x00FFu);
+				UART_EndFrame_IT(cuart);
+				
+				//Sleep until next Address Word
+				if(cuart->RxMode == UART_RxMode_Address)
+				{
+					UART_RX_MUTE(cuart);
+				}
+				return;
 			}
-			else
+			//IDLE User Callback
+			UART_STATS_INC(cuart, IdleCallbacks);
+			CSL_UART_IDLECallback(cuart);
+			/** Disable Interrupt or not depends on user **/
+		}
+	}
+	
+	//Some errors occured
+	if(errorflags == SET)
+	{
+		//Error Overflow
+		if((s1_flag & UART_Err_OR) != RESET)
+		{
+			cuart->ErrorCode |= CSL_UART_ERROR_ORE;
+			UART_STATS_INC(cuart, OverrunErrors);
+		}
+		
+		//Error Noise
+		if((s1_flag & UART_Err_NF) != RESET)
+		{
+			cuart->ErrorCode |= CSL_UART_ERROR_NE;
+			UART_STATS_INC(cuart, NoiseErrors);
+		}
+		
+		//Error Frame-error
+		if((s1_flag & UART_Err_FE) != RESET)
+		{
+			cuart->ErrorCode |= CSL_UART_ERROR_FE;
+			UART_STATS_INC(cuart, FramingErrors);
+		}
+		
+		//Error Parity
+		if((s1_flag & UART_Err_PF) != RESET)
+		{
+			cuart->ErrorCode |= CSL_UART_ERROR_PE;
+			UART_STATS_INC(cuart, ParityErrors);
+		}
+		
+		//Clear the Error Flags
+		__CSL_UART_FLUSH_S1(cuart);
+		__CSL_UART_FLUSH_DR(cuart);
+		
+		//Discard the broken Frame, restart in the same Buffer
+		if(UART_IS_FRAME_MODE(cuart))
+		{
+			cuart->pRxBuffer = cuart->pRxFrame[cuart->RxFrameIndex];
+			cuart->pRxXferCount = cuart->pRxXferSize;
+			
+			//Address is not trusted any more, wait for next Address Word
+			if(cuart->RxMode == UART_RxMode_Address)
 			{
-				*cuart->pRxBuffer++ = (uint8_t)(cuart->Instance->D & 0x007Fu);
+				UART_RX_MUTE(cuart);
 			}
 		}
 		
-		if(--cuart->pRxXferCount == 0u)
+		//Ring and IDLE Reception never stop, report the error only
+		if(cuart->RxMode != UART_RxMode_Buffer)
 		{
-			//Disable Receive Interrupt(RIE, ILIE)
-			CLEAR_BIT(cuart->Instance->C2, UART_C2_RIE_MASK | UART_C2_ILIE_MASK);
-			
-			//Disable Error Interrupt(ORIE, NEIE, FEIE, PEIE)
-			CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
-			
-			//User Callback
-			CSL_UART_RxCpltCallback(cuart);
-			
-			cuart->RxState = CSL_UART_STATE_READY;
-			
-			return CSL_OK;
+			UART_STATS_INC(cuart, ErrorCallbacks);
+			CSL_UART_ErrorCallback(cuart);
+			cuart->ErrorCode = CSL_UART_ERROR_NONE;
+			return;
 		}
+		
+		//Disable Error Interrupt
+		CLEAR_BIT(cuart->Instance->C3, 0x0Fu);
+		
+		//Reset UART Handle
+		cuart->gState = CSL_UART_STATE_READY;
+		cuart->RxState = CSL_UART_STATE_READY;
+		
+		//Error Callback Funtion
+		UART_STATS_INC(cuart, ErrorCallbacks);
+		CSL_UART_ErrorCallback(cuart);
+		
+		//Clear Error Code
+		cuart->ErrorCode = CSL_UART_ERROR_NONE;
+		
+		//exit
+		return;
 	}
 	
-	return CSL_OK;
+	//UARTx is in Mode Transmitter
+	it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_TIE_MASK);
+	isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_TDRE_MASK);
+	if((it_flags && isr_flags) == SET)
+	{
+		//RS-485 Driver is not on for Data yet
+		if(UART_RS485_ENABLED(cuart) && (cuart->RS485.Phase != UART_RS485_Phase_Data))
+		{
+			UART_RS485_Start(cuart);
+			return;
+		}
+		cuart->TxISR(cuart);
+		return;
+	}
+	
+	//UARTx is in Mode Transmitter
+	it_flags = __CSL_UART_GET_IT(cuart->Instance->C2, UART_C2_TCIE_MASK);
+	isr_flags = __CSL_UART_GET_FLAG(s1_flag, UART_S1_TC_MASK);
+	if((it_flags && isr_flags) == SET)
+	{
+		UART_EndTransmit_IT(cuart);
+		return;
+	}
 }
 
 //EOF
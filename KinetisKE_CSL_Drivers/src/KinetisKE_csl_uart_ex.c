@@ -0,0 +1,342 @@
+/**
+ * Title 	UART Extra Functions in CSL for KEAZxxx(Source File)
+ * License	GPLv2.0
+ * Author	Stark Zhang
+ * Debug	None
+**/
+
+#include "KinetisKE_csl_uart_ex.h"
+
+/** UART Extra Private Functions Declaration(do not call these in user code) **/
+static uint32_t UARTEx_TimerClock(void);
+static uint16_t UARTEx_SBR(uint32_t BaudRate);
+static int16_t UARTEx_Error(uint16_t SBR, uint32_t BaudRate);
+static void UARTEx_AutoBaud_Arm(UART_AutoBaudTypeDef* cab);
+static void UARTEx_AutoBaud_Program(UART_AutoBaudTypeDef* cab);
+
+/** Standard BaudRates for Fallback **/
+static const uint32_t UARTEx_StdBaudRate[] =
+{
+	1200u, 2400u, 4800u, 9600u, 14400u, 19200u, 38400u, 57600u, 115200u, 230400u, 460800u,
+};
+
+/**
+ * @brief	Start Auto-BaudRate Detection
+ * @param	UART_AutoBaudTypeDef* cab
+ *				Auto-BaudRate Handle
+ * @return	CSL_OK/CSL_Error
+ * @note	Remote Device sends UART_AUTOBAUD_SYNC(0x55) after this function,
+ *			PWTIN3 is connected to RxD of this UART internally(SIM_SOPT1[UARTPWTS]).
+ *			Receiver is disabled during the Detection, so the Sync Character is not received.
+ *			PWT Clock Gate & NVIC of UART and PWT are enabled by User.
+ *			UARTx_IRQHandler() calls CSL_UARTEx_AutoBaud_IRQHandler() until Detection is done.
+**/
+CSL_StatusTypeDef CSL_UARTEx_AutoBaud_Start(UART_AutoBaudTypeDef* cab)
+{
+	uint32_t period = 0u;
+
+	if((cab == NULL) || (cab->cuart == NULL) || (cab->MinBaudRate == 0u))
+	{
+		return CSL_Error;
+	}
+
+	//UART is not ready
+	if(cab->cuart->gState != CSL_UART_STATE_READY)
+	{
+		return CSL_Busy;
+	}
+	cab->cuart->gState = CSL_UART_STATE_BUSY;
+	cab->cuart->RxState = CSL_UART_STATE_BUSY_RX;
+
+	//Receiver off, only Rx Pin Edges are watched
+	CLEAR_BIT(cab->cuart->Instance->C2, UART_C2_RE_MASK | UART_C2_RIE_MASK);
+
+	//Route RxD of this UART to PWTIN3
+	SIM->SOPT1 &= ~SIM_SOPT1_UARTPWTS_MASK;
+	if(cab->cuart->Instance == UART1)
+	{
+		SIM->SOPT1 |= SIM_SOPT1_UARTPWTS(1u);
+	}
+	else if(cab->cuart->Instance == UART2)
+	{
+		SIM->SOPT1 |= SIM_SOPT1_UARTPWTS(2u);
+	}
+
+	//Prescaler keeps the longest Period(2 Bits at MinBaudRate) in 16-bit Counter
+	period = UARTEx_TimerClock() / cab->MinBaudRate * 2u;
+	cab->Prescaler = 0u;
+	while(((period >> cab->Prescaler) > 0xFFFFu) && (cab->Prescaler < 7u))
+	{
+		cab->Prescaler++;
+	}
+
+	cab->Fallback = RESET;
+	cab->Error = 0;
+	UARTEx_AutoBaud_Arm(cab);
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	Stop Auto-BaudRate Detection & restore UART
+ * @param	UART_AutoBaudTypeDef* cab
+ *				Auto-BaudRate Handle
+ * @return	CSL_OK/CSL_Error
+ * @note	UART keeps its BaudRate if Detection is not done.
+**/
+CSL_StatusTypeDef CSL_UARTEx_AutoBaud_Stop(UART_AutoBaudTypeDef* cab)
+{
+	if((cab == NULL) || (cab->cuart == NULL))
+	{
+		return CSL_Error;
+	}
+
+	//Detection is not running
+	if((cab->State != CSL_UART_AUTOBAUD_WAIT) && (cab->State != CSL_UART_AUTOBAUD_MEASURE))
+	{
+		return CSL_OK;
+	}
+
+	//PWT off
+	PWT->R1 = (uint32_t)0x00u;
+
+	//Rx Edge Interrupt off
+	CLEAR_BIT(cab->cuart->Instance->BDH, UART_BDH_RXEDGIE_MASK);
+	__CSL_UART_CLEAR_RXEDGIF(cab->cuart);
+
+	//Restore Receiver
+	cab->cuart->Instance->C2 |= (cab->cuart->Init.UART_Mode & UART_C2_RE_MASK);
+	cab->cuart->gState = CSL_UART_STATE_READY;
+	cab->cuart->RxState = CSL_UART_STATE_READY;
+	cab->State = CSL_UART_AUTOBAUD_RESET;
+
+	return CSL_OK;
+}
+
+/**
+ * @brief	UART Interrupt Service Requestion during Auto-BaudRate Detection
+ * @param	UART_AutoBaudTypeDef* cab
+ *				Auto-BaudRate Handle
+ * @return	None
+ * @note	Start Bit Edge of Sync Character enables PWT,
+ *			so PWT starts at the falling Edge of Data Bit 1.
+**/
+void CSL_UARTEx_AutoBaud_IRQHandler(UART_AutoBaudTypeDef* cab)
+{
+	UART_Type* uart = cab->cuart->Instance;
+
+	if(((uart->BDH & UART_BDH_RXEDGIE_MASK) == RESET) || ((uart->S2 & UART_S2_RXEDGIF_MASK) == RESET))
+	{
+		return;
+	}
+
+	//Clear Flag & disable Rx Edge Interrupt until next Sync Character
+	__CSL_UART_CLEAR_RXEDGIF(cab->cuart);
+	CLEAR_BIT(uart->BDH, UART_BDH_RXEDGIE_MASK);
+
+	if(cab->State == CSL_UART_AUTOBAUD_WAIT)
+	{
+		cab->Sum = 0u;
+		cab->Count = 0u;
+		cab->State = CSL_UART_AUTOBAUD_MEASURE;
+		__PWT_ENBALE();
+	}
+}
+
+/**
+ * @brief	PWT Interrupt Service Requestion during Auto-BaudRate Detection
+ * @param	UART_AutoBaudTypeDef* cab
+ *				Auto-BaudRate Handle
+ * @return	None
+ * @note	Call this instead of CSL_PWT_IRQHandler() in PWT_IRQHandler().
+ *			Periods differing more than 25% from the first one are not a Sync Character,
+ *			Detection is re-armed for next Start Bit.
+**/
+void CSL_UARTEx_AutoBaud_PWT_IRQHandler(UART_AutoBaudTypeDef* cab)
+{
+	uint32_t r1 = PWT->R1;
+	uint16_t period = 0u;
+
+	//OverFlow: Line is idle or too slow, restart
+	if((r1 & PWT_R1_PWTOV_MASK) != RESET)
+	{
+		UARTEx_AutoBaud_Arm(cab);
+		return;
+	}
+
+	if(((r1 & PWT_R1_PWTRDY_MASK) == RESET) || (cab->State != CSL_UART_AUTOBAUD_MEASURE))
+	{
+		return;
+	}
+
+	//Falling-to-Falling Period(2 Bits)
+	period = (uint16_t)((r1 >> 16) + (PWT->R2 & PWT_R2_NPW_MASK));
+	PWT->R1 &= ~PWT_R1_PWTRDY_MASK;
+
+	if(cab->Count == 0u)
+	{
+		cab->First = period;
+	}
+	else if((period > cab->First + (cab->First >> 2)) || (period < cab->First - (cab->First >> 2)))
+	{
+		UARTEx_AutoBaud_Arm(cab);
+		return;
+	}
+
+	cab->Sum += period;
+	if(++cab->Count < UART_AUTOBAUD_PERIODS)
+	{
+		return;
+	}
+
+	//Sync Character measured
+	PWT->R1 = (uint32_t)0x00u;
+	UARTEx_AutoBaud_Program(cab);
+	CSL_UARTEx_AutoBaudCpltCallback(cab);
+}
+
+/**
+ * @brief	Auto-BaudRate Detection Complete Callback
+ * @param	UART_AutoBaudTypeDef* cab
+ *				Auto-BaudRate Handle
+ * @return	None
+ * @note	cab->BaudRate, cab->Error and cab->Fallback are valid here.
+**/
+__weak void CSL_UARTEx_AutoBaudCpltCallback(UART_AutoBaudTypeDef* cab)
+{
+	UNUSED(cab);
+}
+
+/** UART Extra Private Functions **/
+/**
+ * @brief	Timer Clock of PWT(ICSOUTCLK / (OUTDIV3 + 1))
+**/
+static uint32_t UARTEx_TimerClock(void)
+{
+	uint32_t ics_clk = SystemCoreClock * (1u + ((SIM->CLKDIV & SIM_CLKDIV_OUTDIV1_MASK) >> SIM_CLKDIV_OUTDIV1_SHIFT));
+
+	if((SIM->CLKDIV & SIM_CLKDIV_OUTDIV3_MASK) != 0x00u)
+	{
+		ics_clk >>= 1;
+	}
+
+	return ics_clk;
+}
+
+/**
+ * @brief	SBR of a BaudRate(same rounding as UART_BaudRate_Cal())
+**/
+static uint16_t UARTEx_SBR(uint32_t BaudRate)
+{
+	uint32_t SBR = ((SystemBusClock >> 4) + (BaudRate >> 1)) / BaudRate;
+
+	if(SBR == 0u)
+	{
+		SBR = 1u;
+	}
+	else if(SBR > 0x1FFFu)
+	{
+		SBR = 0x1FFFu;
+	}
+
+	return (uint16_t)SBR;
+}
+
+/**
+ * @brief	Error of BaudRate generated by SBR in 0.01%
+**/
+static int16_t UARTEx_Error(uint16_t SBR, uint32_t BaudRate)
+{
+	int32_t actual = (int32_t)((SystemBusClock >> 4) / SBR);
+	int32_t error = 0x7FFF;
+
+	//(actual - BaudRate) / BaudRate without 32-bit overflow
+	if(BaudRate >= 100u)
+	{
+		error = (actual - (int32_t)BaudRate) * 100 / ((int32_t)BaudRate / 100);
+	}
+
+	if(error > 0x7FFF)
+	{
+		error = 0x7FFF;
+	}
+	else if(error < -0x7FFF)
+	{
+		error = -0x7FFF;
+	}
+
+	return (int16_t)error;
+}
+
+/**
+ * @brief	Wait for Start Bit of next Sync Character
+**/
+static void UARTEx_AutoBaud_Arm(UART_AutoBaudTypeDef* cab)
+{
+	//PWT: Timer Clock, falling Edge starts and triggers each Measurement, PWTIN3
+	PWT->R1 = PWT_R1_PWTSR_MASK;
+	PWT->R1 = PWT_CLKSource_TIMCLK | PWT_R1_PRE(cab->Prescaler) | PWT_Edge_E1 | PWT_R1_PINSEL(3u)
+			| PWT_R1_PRDYIE_MASK | PWT_R1_POVIE_MASK | PWT_R1_PWTIE_MASK;
+
+	cab->State = CSL_UART_AUTOBAUD_WAIT;
+
+	//Start Bit is the next falling Edge on RxD
+	__CSL_UART_CLEAR_RXEDGIF(cab->cuart);
+	SET_BIT(cab->cuart->Instance->BDH, UART_BDH_RXEDGIE_MASK);
+}
+
+/**
+ * @brief	Calculate & program SBR from measured Periods
+ * @note	Falls back to the nearest standard BaudRate if Residual Error exceeds MaxError.
+**/
+static void UARTEx_AutoBaud_Program(UART_AutoBaudTypeDef* cab)
+{
+	UART_Type* uart = cab->cuart->Instance;
+	uint32_t bits = (cab->Sum << cab->Prescaler) / (UART_AUTOBAUD_PERIODS * 2u);
+	uint32_t nominal = 0u;
+	uint32_t diff = 0u;
+	uint16_t SBR = 0u;
+	uint8_t i = 0u;
+
+	if(bits == 0u)
+	{
+		bits = 1u;
+	}
+	cab->MeasuredBaud = (UARTEx_TimerClock() + (bits >> 1)) / bits;
+	nominal = cab->MeasuredBaud;
+	SBR = UARTEx_SBR(nominal);
+	cab->Error = UARTEx_Error(SBR, cab->MeasuredBaud);
+
+	//Measured Rate cannot be generated precisely, use nearest standard Rate
+	if(((cab->Error < 0) ? -cab->Error : cab->Error) > cab->MaxError)
+	{
+		diff = 0xFFFFFFFFu;
+		for(i = 0u; i < sizeof(UARTEx_StdBaudRate) / sizeof(UARTEx_StdBaudRate[0]); i++)
+		{
+			uint32_t d = (UARTEx_StdBaudRate[i] > cab->MeasuredBaud) ? (UARTEx_StdBaudRate[i] - cab->MeasuredBaud)
+																	 : (cab->MeasuredBaud - UARTEx_StdBaudRate[i]);
+			if(d < diff)
+			{
+				diff = d;
+				nominal = UARTEx_StdBaudRate[i];
+			}
+		}
+		SBR = UARTEx_SBR(nominal);
+		cab->Error = UARTEx_Error(SBR, cab->MeasuredBaud);
+		cab->Fallback = SET;
+	}
+
+	//BDL write latches SBR, other Bits in BDH are kept
+	uart->BDH = (uart->BDH & ~UART_BDH_SBR_MASK) | (uint8_t)(SBR >> 8);
+	uart->BDL = (uint8_t)(SBR & 0xFFu);
+	cab->cuart->Init.BuadRate = nominal;
+	cab->BaudRate = (SystemBusClock >> 4) / SBR;
+
+	//Receiver back on
+	uart->C2 |= (cab->cuart->Init.UART_Mode & UART_C2_RE_MASK);
+	cab->cuart->gState = CSL_UART_STATE_READY;
+	cab->cuart->RxState = CSL_UART_STATE_READY;
+	cab->State = CSL_UART_AUTOBAUD_DONE;
+}
+
+//EOF